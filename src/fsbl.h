@@ -218,6 +218,25 @@
 *						remaining in unknown state.
 *						Resolution: LinearBootDeviceFlag is initialized 0
 *						in main.c
+* 12.00a hx 10/18/26	Added FSBL_CONSOLE_BUFFERED flag
+*						Added FSBL_TIMELINE flag
+*						Added FSBL_PMU flag
+*						Added FSBL_CACHED_LOAD flag
+*						Added FSBL_BOOT_DELAY_MS, FSBL_BOOT_DELAY_STRAP_PIN
+*						Added PS7_INIT_INTERPRETED flag
+*						Added PS7_WARM_RESET_FAST flag
+*						Added PS7_DDR_TRAIN_CACHE flag
+*						Added FSBL_POLL_*_US settings
+*						Added FSBL_DDR_TEST_BUDGET_US
+*						Added NAND_SMC_CLK_HZ, FSBL_POLL_NAND_READY_US
+*						Removed NAND_FLASH_SIZE, NAND size is read at run time
+*						Added NOR_SMC_CYCLES, NOR_SMC_OPMODE, NOR_DMA_MIN_BYTES
+*						Added FSBL_DMA_COPY flag
+*						Added SD_CACHE_SIZE, SD_CACHE_READ_MAX, SD_LINKMAP_ENTRIES
+*						Added FSBL_SD_HIGH_SPEED flag
+*						Added FSBL_SD_RAW_LBA flag
+*						Added FSBL_SD_ADMA flag
+*						Added FSBL_IMAGE_DIRECTORY flag
 *
 * </pre>
 *
@@ -277,6 +296,143 @@
 * MMC_SUPPORT
 * This flag is used to enable MMC support feature
 *
+* FSBL_CONSOLE_BUFFERED
+* This flag makes the console output interrupt driven. fsbl_printf and
+* xil_printf only queue the characters in a TX ring which is drained by the
+* UART TX FIFO empty interrupt, so the boot path does not wait on the UART.
+* The ring is flushed completely before handoff and on fallback.
+* The ring size is set with CONSOLE_TX_BUFFER_SIZE (default 4096 bytes)
+*
+* FSBL_TIMELINE
+* This flag enables the boot timeline. The FSBL records a stage identifier
+* and the 64 bit global timer value at the end of ps7_init, the DDR check,
+* PCAP init, boot device init, every move/verify/authenticate/decrypt/PCAP
+* phase of each partition and at handoff. The timeline is kept in OCM at
+* FSBL_TIMELINE_ADDR (reserved in lscript.ld) and its address is passed to
+* the application in R1, refer to fsbl_timeline.h for the layout
+*
+* FSBL_PMU
+* This flag enables profiling of the hot paths with the Cortex-A9 PMU.
+* The MoveImage implementations, md5, sha_256, rsa2048_pubexp, XDcfgPollDone
+* and XQspiPs_PolledTransfer are wrapped in PMU_SCOPE_BEGIN/PMU_SCOPE_END.
+* Each scope accumulates CPU cycles and two event counters (FSBL_PMU_EVENT0
+* and FSBL_PMU_EVENT1) and the totals and call counts are printed at handoff.
+* Without the flag the scope macros expand to nothing
+*
+* FSBL_CACHED_LOAD
+* This flag keeps the MMU and the data cache on while LoadBootImage runs,
+* with DDR mapped write-back cacheable, so the partition copies, MD5/SHA-256
+* and RSA run from the cache. The PCAP DMA buffers are cleaned/invalidated
+* around each transfer, SD reads are done with the cache off and the whole
+* cache is written back before handoff and fallback
+*
+* FSBL_DMA_COPY
+* This flag moves the QSPI linear and I/O mode copies and the NOR reads
+* with the PS DMA controller (PL330) instead of the CPU. Copies below
+* DMA_MIN_BYTES (default 256) stay on the CPU. Refer to fsbl_dma.h
+*
+* FSBL_SD_HIGH_SPEED
+* This flag makes InitSD negotiate the SD/eMMC bus before BOOT.BIN is read:
+* 4 bit width, High Speed timing and a 50 MHz SD clock, checked with a test
+* read of sector 0 and stepped back if it fails. The negotiated width, clock
+* and bandwidth are printed. SD_BUS_REF_CLK_HZ is the SDIO reference clock,
+* refer to sd_bus.c
+*
+* FSBL_SD_RAW_LBA
+* This flag reads BOOT.BIN from the SD/eMMC sectors without FatFs. The image
+* is described by a raw boot header at SD_RAW_HEADER_OFFSET in LBA 0: the
+* words "XRAW" (0x57415258), first sector, sector count and the complement
+* of their sum. Without a header SD_RAW_LBA is used when set. The first
+* sector must hold a boot image, otherwise BOOT.BIN is opened from the FAT
+* file system as before. Refer to sd.h
+*
+* FSBL_SD_ADMA
+* This flag reads each run of consecutive BOOT.BIN sectors with one SD
+* command, the controller writes it straight to the destination through an
+* ADMA2 descriptor chain. Reads shorter than SD_DMA_MIN_BYTES (default 4096)
+* stay with the driver. On the FAT path the runs come from the cluster link
+* map, so _USE_FASTSEEK is needed. Refer to sd_dma.c
+*
+* FSBL_IMAGE_DIRECTORY
+* This flag makes the fallback look the next image up in an image directory
+* at IMAGE_DIRECTORY_OFFSET (default 0xFF8000, the last 32 KB of a 16 MB
+* flash) before searching the flash. The directory holds the words "XDIR"
+* (0x52494458), the entry count, IMAGE_DIRECTORY_ENTRIES (default 16) image
+* offsets and the complement of the sum of all of them. Each listed image
+* is checked like a found one. The flash is searched as before when the
+* directory is missing, corrupted or lists no valid image
+*
+* FSBL_BOOT_DELAY_MS
+* Window in milliseconds before handoff in which a console keypress holds
+* the boot for up to FSBL_BOOT_DELAY_HOLD_SECOND (default 90), a second
+* keypress continues. The default is 0, no delay
+*
+* FSBL_BOOT_DELAY_STRAP_PIN
+* When defined, the boot is held from the start if this GPIO pin reads
+* FSBL_BOOT_DELAY_STRAP_LEVEL (default 1)
+*
+* NAND_SMC_CLK_HZ
+* SMC clock in Hz, not defined by default. When it is defined, usually to
+* XPAR_PS7_NAND_0_NAND_CLK_FREQ_HZ, InitNand moves the NAND device and the
+* SMC to the fastest ONFI timing mode both support. Without it the BootROM
+* timing is kept. Refer to nand.h
+*
+* NOR_SMC_CYCLES, NOR_SMC_OPMODE
+* SMC set_cycles and set_opmode values InitNor programs for the NOR part,
+* the opmode can enable page reads. Refer to nor.h
+*
+* NOR_DMA_MIN_BYTES
+* NOR reads of at least this size go through the DMAC with FSBL_DMA_COPY,
+* through the PCAP DMA otherwise, default 4096
+*
+* SD_CACHE_SIZE, SD_CACHE_READ_MAX
+* SD reads of at most SD_CACHE_READ_MAX bytes (default 1024), the header
+* reads, are served from a SD_CACHE_SIZE (default 8192) cache of BOOT.BIN
+*
+* SD_LINKMAP_ENTRIES
+* Size of the cluster link map InitSD builds for BOOT.BIN when FatFs fast
+* seek (_USE_FASTSEEK) is enabled in the xilffs configuration, default 64
+*
+* FSBL_DDR_TEST_BUDGET_US
+* Time in microseconds the DDR test may spend on its march over sampled
+* blocks after the data and address line checks, default 5000. 0 runs the
+* line checks only. Refer to fsbl_ddrtest.h
+*
+* FSBL_POLL_PS7_MASKPOLL_US, FSBL_POLL_PS7_PLL_LOCK_US,
+* FSBL_POLL_DCFG_DMA_DONE_US, FSBL_POLL_DCFG_PCFG_DONE_US,
+* FSBL_POLL_NAND_READY_US, FSBL_POLL_DMA_DONE_US,
+* FSBL_POLL_SD_CMD_US, FSBL_POLL_SD_READY_US, FSBL_POLL_SD_DMA_US,
+* FSBL_POLL_QSPI_WRITE_US
+* Timeouts in microseconds of the ps7_init polls, of the PCAP waits, of
+* the NAND ready waits, of the DMAC copies, of the SD commands, card
+* power up and ADMA2 reads and of the QSPI sector erase and page program, measured on the global timer. The time spent at
+* each is reported on the debug console and in the boot timeline, refer to
+* fsbl_poll.h
+*
+* PS7_INIT_INTERPRETED
+* By default ps7_init runs the register sequences precompiled from the
+* ps7_init.c tables by tools/ps7_compile.py (ps7_init_gen.c). This flag
+* brings back the ps7_config() table walk and the tables themselves
+*
+* PS7_WARM_RESET_FAST
+* On a reset other than power on, ps7_init skips the PLL and DDR stages if
+* the PLLs are locked, the DDRC is in normal operation and the PLL, DDRIOB
+* and DDRC registers match the fingerprint generated from the tables.
+* Only MIO (without DDRIOB), clock and peripheral setup are redone. The
+* reset reason is read from RESET_REASON on silicon 1.0 and from
+* REBOOT_STATUS[23:16] on later silicon. Needs the precompiled ps7_init
+*
+* PS7_DDR_TRAIN_CACHE
+* The DDR PHY training result is kept in a checksummed record in OCM
+* (PS7_DDR_TRAIN_ADDR). When a record for the same DDR configuration is
+* found in OCM or, with PS7_DDR_TRAIN_FLASH_OFFSET, in the QSPI boot flash,
+* ps7_init programs it instead of running the training, as long as each
+* ratio is within PS7_DDR_TRAIN_WINDOW (default 0x80, 1/256 clock) of the
+* PCW ratio. FSBL checks DDR with a short memory test and trains again if
+* the record does not work. When booting from QSPI, a fresh training
+* result is written to the flash at PS7_DDR_TRAIN_FLASH_OFFSET, which has
+* to be a 64 KB erase sector of its own below 16 MB
+*
 *******************************************************************************/
 #ifndef XIL_FSBL_H
 #define XIL_FSBL_H
@@ -420,6 +576,17 @@ extern "C" {
  */
 #define GOLDEN_IMAGE_OFFSET		0x8000
 
+/*
+ * Image directory, "XDIR"
+ */
+#define IMAGE_DIRECTORY_MAGIC	0x52494458
+#ifndef IMAGE_DIRECTORY_OFFSET
+#define IMAGE_DIRECTORY_OFFSET	0x00FF8000
+#endif
+#ifndef IMAGE_DIRECTORY_ENTRIES
+#define IMAGE_DIRECTORY_ENTRIES	16
+#endif
+
 /*
  * Silicon Version
  */
@@ -452,10 +619,9 @@ extern "C" {
 /*
  *
  */
-#define QSPI_DUAL_FLASH_SIZE	0x2000000; /*32MB*/
-#define QSPI_SINGLE_FLASH_SIZE	0x1000000; /*16MB*/
-#define NAND_FLASH_SIZE			0x8000000; /*128MB*/
-#define NOR_FLASH_SIZE			0x2000000; /*32MB*/
+#define QSPI_DUAL_FLASH_SIZE	0x2000000 /*32MB*/
+#define QSPI_SINGLE_FLASH_SIZE	0x1000000 /*16MB*/
+#define NOR_FLASH_SIZE			0x2000000 /*32MB*/
 #define	LQSPI_CFG_OFFSET		0xA0
 #define LQSPI_CFG_DUAL_FLASH_MASK	0x40000000
 
@@ -513,7 +679,7 @@ void FsblGetGlobalTime (XTime * tCur);
 void FsblMeasurePerfTime (XTime tCur, XTime tEnd);
 #endif
 void GetSiliconVersion(void);
-void FsblHandoffExit(u32 FsblStartAddr);
+void FsblHandoffExit(u32 FsblStartAddr, u32 TimelineAddr);
 void FsblHandoffJtagExit();
 /************************** Variable Definitions *****************************/
 extern int SkipPartition;
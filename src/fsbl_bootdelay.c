@@ -0,0 +1,200 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_bootdelay.c
+*
+* Contains the boot delay policy, refer to fsbl_bootdelay.h
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* Replaces the fixed 90 second wait that used to run before every handoff.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "fsbl.h"
+#include "fsbl_bootdelay.h"
+#include "fsbl_timeline.h"
+#include "xtime_l.h"
+#include "xparameters.h"
+
+#ifdef STDOUT_BASEADDRESS
+#include "xuartps_hw.h"
+#endif
+
+#ifdef FSBL_BOOT_DELAY_STRAP_PIN
+#include "xgpiops_polled.h"
+#endif
+
+#ifdef XPAR_XWDTPS_0_BASEADDR
+#include "xwdtps.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+#define BOOT_DELAY_COUNTS_PER_MS	(COUNTS_PER_SECOND / 1000)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 BootDelayKeyPressed(void);
+static u32 BootDelayWait(u32 Milliseconds);
+
+/************************** Variable Definitions *****************************/
+#ifdef XPAR_XWDTPS_0_BASEADDR
+extern XWdtPs Watchdog;	/* Instance of WatchDog Timer	*/
+#endif
+
+/******************************************************************************/
+/**
+*
+* This function applies the boot delay policy. It returns at once when
+* FSBL_BOOT_DELAY_MS is 0 and the strap is not set.
+*
+* @param	None
+*
+* @return	None
+*
+* @note		The time spent is recorded in the boot timeline
+*
+****************************************************************************/
+void FsblBootDelay(void)
+{
+	u32 Hold = 0;
+	u32 Waited = 0;
+
+#ifdef FSBL_BOOT_DELAY_STRAP_PIN
+	if (GpioReadStrap(FSBL_BOOT_DELAY_STRAP_PIN) ==
+			FSBL_BOOT_DELAY_STRAP_LEVEL) {
+		fsbl_printf(DEBUG_GENERAL,"Boot delay strap set\r\n");
+		Hold = 1;
+	}
+#endif
+
+	if ((!Hold) && (FSBL_BOOT_DELAY_MS != 0)) {
+		fsbl_printf(DEBUG_GENERAL,
+				"Press any key within %d ms to hold the boot\r\n",
+				FSBL_BOOT_DELAY_MS);
+		Hold = BootDelayWait(FSBL_BOOT_DELAY_MS);
+		Waited = FSBL_BOOT_DELAY_MS;
+	}
+
+	if (Hold) {
+		u32 Second;
+
+		fsbl_printf(DEBUG_GENERAL,
+				"Boot held for up to %d seconds, press any key to continue\r\n",
+				FSBL_BOOT_DELAY_HOLD_SECOND);
+
+		for (Second = 0; Second < FSBL_BOOT_DELAY_HOLD_SECOND; Second++) {
+			if (BootDelayWait(1000)) {
+				break;
+			}
+			fsbl_printf(DEBUG_GENERAL,".");
+		}
+		fsbl_printf(DEBUG_GENERAL,"\r\n");
+		Waited += Second * 1000;
+	}
+
+	if (Waited != 0) {
+		TimelineMark(TIMELINE_BOOT_DELAY, 0, Waited);
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for the given time or until a key is pressed on the
+* console.
+*
+* @param	Milliseconds is the time to wait
+*
+* @return	1 if a key was pressed, 0 on timeout
+*
+* @note		The watchdog is kept alive while waiting
+*
+****************************************************************************/
+static u32 BootDelayWait(u32 Milliseconds)
+{
+	XTime Start;
+	XTime Now;
+	XTime Counts = (XTime)Milliseconds * BOOT_DELAY_COUNTS_PER_MS;
+
+	XTime_GetTime(&Start);
+
+	do {
+#ifdef XPAR_XWDTPS_0_BASEADDR
+		XWdtPs_RestartWdt(&Watchdog);
+#endif
+		if (BootDelayKeyPressed()) {
+			return 1;
+		}
+		XTime_GetTime(&Now);
+	} while ((Now - Start) < Counts);
+
+	return 0;
+}
+
+/******************************************************************************/
+/**
+*
+* This function checks for a character on the console UART and drops it.
+*
+* @param	None
+*
+* @return	1 if a character was received, 0 otherwise
+*
+* @note		Always 0 when there is no console UART
+*
+****************************************************************************/
+static u32 BootDelayKeyPressed(void)
+{
+#ifdef STDOUT_BASEADDRESS
+	if (XUartPs_IsReceiveData(STDOUT_BASEADDRESS)) {
+		(void)XUartPs_ReadReg(STDOUT_BASEADDRESS, XUARTPS_FIFO_OFFSET);
+		return 1;
+	}
+#endif
+	return 0;
+}
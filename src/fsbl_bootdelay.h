@@ -0,0 +1,104 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_bootdelay.h
+*
+* Contains the boot delay policy applied just before handoff.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* The default delay is zero, so a production boot goes straight to the
+* handoff. For board bring up the delay is set with FSBL_BOOT_DELAY_MS,
+* a keypress on the console during that window holds the boot for
+* FSBL_BOOT_DELAY_HOLD_SECOND and a second keypress releases it. A GPIO
+* strap (FSBL_BOOT_DELAY_STRAP_PIN) holds the boot from the start.
+*
+******************************************************************************/
+#ifndef ___FSBL_BOOTDELAY_H___
+#define ___FSBL_BOOTDELAY_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Window in milliseconds in which a keypress holds the boot, 0 disables
+ * the keypress check
+ */
+#ifndef FSBL_BOOT_DELAY_MS
+#define FSBL_BOOT_DELAY_MS				0
+#endif
+
+/*
+ * Upper bound of a held boot in seconds
+ */
+#ifndef FSBL_BOOT_DELAY_HOLD_SECOND
+#define FSBL_BOOT_DELAY_HOLD_SECOND		90
+#endif
+
+/*
+ * Level of FSBL_BOOT_DELAY_STRAP_PIN which holds the boot
+ */
+#ifndef FSBL_BOOT_DELAY_STRAP_LEVEL
+#define FSBL_BOOT_DELAY_STRAP_LEVEL		1
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+void FsblBootDelay(void);
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___FSBL_BOOTDELAY_H___ */
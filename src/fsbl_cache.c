@@ -0,0 +1,229 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_cache.c
+*
+* Contains the cache enabled load mode, compiled with FSBL_CACHED_LOAD.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+* 1.01a hx	10/18/26	Range maintenance covers the low OCM as well
+*
+* </pre>
+*
+* @note
+*
+* Only the DDR sections of the translation table are touched, the OCM
+* section and the device regions keep the attributes set up by the BSP.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "fsbl_cache.h"
+
+#ifdef FSBL_CACHED_LOAD
+
+#include "fsbl.h"
+#include "xil_cache.h"
+#include "xpseudo_asm.h"
+#include "xreg_cortexa9.h"
+
+/************************** Constant Definitions *****************************/
+#define CACHE_SECTION_SHIFT		20
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CacheIsRamRange(Address, Length) \
+	(((Address) <= DDR_END_ADDR) && ((Length) != 0))
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+extern u32 MMUTable[];
+
+static u32 CacheLoadEnabled;
+
+/******************************************************************************/
+/**
+*
+* This function maps DDR write-back cacheable in the translation table and
+* turns the data cache on.
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Called with the data cache off, so the table updates reach
+*		memory without any maintenance.
+*
+****************************************************************************/
+void CacheLoadEnable(void)
+{
+	u32 Section;
+
+	if (CacheLoadEnabled) {
+		return;
+	}
+
+	for (Section = DDR_START_ADDR >> CACHE_SECTION_SHIFT;
+			Section <= (DDR_END_ADDR >> CACHE_SECTION_SHIFT); Section++) {
+		MMUTable[Section] = (Section << CACHE_SECTION_SHIFT) |
+				CACHE_DDR_SECTION_ATTR;
+	}
+
+	dsb();
+	mtcp(XREG_CP15_INVAL_UTLB_UNLOCKED, 0);
+	mtcp(XREG_CP15_INVAL_BRANCH_ARRAY, 0);
+	dsb();
+	isb();
+
+	Xil_DCacheEnable();
+	CacheLoadEnabled = 1;
+
+	fsbl_printf(DEBUG_INFO, "Data cache enabled for load\r\n");
+}
+
+/******************************************************************************/
+/**
+*
+* This function cleans the whole data cache and turns it off.
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Safe to call when the cache is already off
+*
+****************************************************************************/
+void CacheLoadDisable(void)
+{
+	if (!CacheLoadEnabled) {
+		return;
+	}
+
+	Xil_DCacheFlush();
+	Xil_DCacheDisable();
+	CacheLoadEnabled = 0;
+}
+
+/******************************************************************************/
+/**
+*
+* This function turns the cache off around code that moves data with a DMA
+* engine which does its own buffering, like the SD driver.
+*
+* @param	None
+*
+* @return	1 if the cache was on and has to be resumed, 0 otherwise
+*
+* @note		None
+*
+****************************************************************************/
+u32 CacheLoadSuspend(void)
+{
+	u32 WasEnabled = CacheLoadEnabled;
+
+	CacheLoadDisable();
+
+	return WasEnabled;
+}
+
+/******************************************************************************/
+/**
+*
+* This function turns the cache back on after CacheLoadSuspend
+*
+* @param	WasEnabled is the value returned by CacheLoadSuspend
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void CacheLoadResume(u32 WasEnabled)
+{
+	if (WasEnabled) {
+		Xil_DCacheEnable();
+		CacheLoadEnabled = 1;
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function writes back and invalidates the cache lines of a low OCM or
+* DDR buffer before a DMA engine reads or writes it.
+*
+* @param	Address is the start of the buffer
+* @param	Length is the buffer length in bytes
+*
+* @return	None
+*
+* @note		Buffers elsewhere (flash windows, PL) are ignored
+*
+****************************************************************************/
+void CacheCleanRange(u32 Address, u32 Length)
+{
+	if (CacheLoadEnabled && CacheIsRamRange(Address, Length)) {
+		Xil_DCacheFlushRange(Address, Length);
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function drops the cache lines of a low OCM or DDR buffer after a DMA
+* engine has written it.
+*
+* @param	Address is the start of the buffer
+* @param	Length is the buffer length in bytes
+*
+* @return	None
+*
+* @note		Buffers elsewhere are ignored
+*
+****************************************************************************/
+void CacheInvalidateRange(u32 Address, u32 Length)
+{
+	if (CacheLoadEnabled && CacheIsRamRange(Address, Length)) {
+		Xil_DCacheInvalidateRange(Address, Length);
+	}
+}
+
+#endif /* FSBL_CACHED_LOAD */
@@ -0,0 +1,107 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_cache.h
+*
+* Contains the interface of the cache enabled load mode.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* With FSBL_CACHED_LOAD the data cache is kept on, with DDR mapped write-back
+* cacheable, while LoadBootImage runs. DMA buffers are made coherent with
+* CacheCleanRange/CacheInvalidateRange and the whole cache is cleaned and
+* turned off again by CacheLoadDisable before handoff or fallback.
+* Without the flag all the calls compile to nothing.
+*
+******************************************************************************/
+#ifndef ___FSBL_CACHE_H___
+#define ___FSBL_CACHE_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions *****************************/
+
+#if defined(FSBL_CACHED_LOAD) && !defined(XPAR_PS7_DDR_0_S_AXI_BASEADDR)
+#undef FSBL_CACHED_LOAD
+#endif
+
+/*
+ * Section descriptor for normal memory, inner and outer write-back write
+ * allocate, shareable
+ */
+#define CACHE_DDR_SECTION_ATTR		0x15DE6
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#ifdef FSBL_CACHED_LOAD
+void CacheLoadEnable(void);
+void CacheLoadDisable(void);
+u32 CacheLoadSuspend(void);
+void CacheLoadResume(u32 WasEnabled);
+void CacheCleanRange(u32 Address, u32 Length);
+void CacheInvalidateRange(u32 Address, u32 Length);
+#else
+#define CacheLoadEnable()
+#define CacheLoadDisable()
+#define CacheLoadSuspend()					(0)
+#define CacheLoadResume(WasEnabled)			((void)(WasEnabled))
+#define CacheCleanRange(Address, Length)
+#define CacheInvalidateRange(Address, Length)
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___FSBL_CACHE_H___ */
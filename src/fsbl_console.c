@@ -0,0 +1,319 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_console.c
+*
+* Contains the buffered console used by fsbl_printf when FSBL_CONSOLE_BUFFERED
+* is set.
+*
+* xil_printf formats one character at a time through outbyte(). This file
+* provides its own outbyte() which puts the character into a TX ring instead
+* of spinning on the UART FIFO. The ring is drained by the UART TX FIFO empty
+* interrupt, so the boot path only pays for the formatting.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* Until ConsoleInit() is called, and again after ConsoleFlush(), the output
+* is written synchronously. If the ring fills up the caller drains it by
+* polling, so no output is ever dropped.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "fsbl_console.h"
+
+#ifdef FSBL_CONSOLE_BUFFERED
+
+#include "xil_io.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include "xuartps_hw.h"
+#include "xscugic.h"
+
+/************************** Constant Definitions *****************************/
+#define CONSOLE_GIC_DEVICE_ID	XPAR_SCUGIC_SINGLE_DEVICE_ID
+
+#if (STDOUT_BASEADDRESS == XPS_UART0_BASEADDR)
+#define CONSOLE_UART_INT_ID		XPS_UART0_INT_ID
+#else
+#define CONSOLE_UART_INT_ID		XPS_UART1_INT_ID
+#endif
+
+#define CONSOLE_TX_BUFFER_MASK	(CONSOLE_TX_BUFFER_SIZE - 1)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define ConsoleTxFull() \
+	((Xil_In32(STDOUT_BASEADDRESS + XUARTPS_SR_OFFSET) & \
+			XUARTPS_SR_TXFULL) == XUARTPS_SR_TXFULL)
+
+/************************** Function Prototypes ******************************/
+void outbyte(char c);
+static void ConsoleTxFill(void);
+static void ConsoleIntrHandler(void *CallBackRef);
+
+/************************** Variable Definitions *****************************/
+static XScuGic ConsoleGic;
+
+static u8 TxBuffer[CONSOLE_TX_BUFFER_SIZE];
+static volatile u32 TxHead;
+static volatile u32 TxTail;
+
+/*
+ * Set while the TX empty interrupt is draining the ring
+ */
+static volatile u32 TxActive;
+
+/*
+ * Set once the interrupt path is ready to be used
+ */
+static u32 ConsoleStarted;
+
+/******************************************************************************/
+/**
+*
+* This function sets up the GIC and the UART TX empty interrupt so that the
+* console output is drained in the background.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the interrupt path is set up
+*		- XST_FAILURE if the GIC could not be initialized, the console
+*		  then stays synchronous
+*
+* @note		Must be called after the exception vector table is set up, the
+*		IRQ handler registered by this function replaces the default one.
+*
+****************************************************************************/
+u32 ConsoleInit(void)
+{
+	XScuGic_Config *GicConfig;
+	u32 Status;
+
+	GicConfig = XScuGic_LookupConfig(CONSOLE_GIC_DEVICE_ID);
+	if (GicConfig == NULL) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_CfgInitialize(&ConsoleGic, GicConfig,
+			GicConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_Connect(&ConsoleGic, CONSOLE_UART_INT_ID,
+			(Xil_ExceptionHandler)ConsoleIntrHandler, NULL);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Only the TX empty interrupt is used, it is enabled on demand
+	 */
+	Xil_Out32(STDOUT_BASEADDRESS + XUARTPS_IDR_OFFSET, XUARTPS_IXR_MASK);
+	Xil_Out32(STDOUT_BASEADDRESS + XUARTPS_ISR_OFFSET, XUARTPS_IXR_MASK);
+
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_IRQ_INT,
+			(Xil_ExceptionHandler)XScuGic_InterruptHandler,
+			&ConsoleGic);
+
+	XScuGic_Enable(&ConsoleGic, CONSOLE_UART_INT_ID);
+
+	TxHead = 0;
+	TxTail = 0;
+	TxActive = 0;
+	ConsoleStarted = 1;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function writes out everything in the ring and waits until the UART
+* has sent the last bit. The console is synchronous again afterwards and the
+* UART interrupt is released, so it is safe to call before handoff and on the
+* fallback path.
+*
+* @param	None
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void ConsoleFlush(void)
+{
+	u32 Cpsr;
+
+	Cpsr = mfcpsr();
+	mtcpsr(Cpsr | XIL_EXCEPTION_IRQ);
+
+	if (ConsoleStarted) {
+		Xil_Out32(STDOUT_BASEADDRESS + XUARTPS_IDR_OFFSET,
+				XUARTPS_IXR_TXEMPTY);
+		XScuGic_Disable(&ConsoleGic, CONSOLE_UART_INT_ID);
+		XScuGic_Disconnect(&ConsoleGic, CONSOLE_UART_INT_ID);
+		ConsoleStarted = 0;
+		TxActive = 0;
+	}
+
+	while (TxHead != TxTail) {
+		ConsoleTxFill();
+	}
+
+	while ((Xil_In32(STDOUT_BASEADDRESS + XUARTPS_SR_OFFSET) &
+			XUARTPS_SR_TXEMPTY) != XUARTPS_SR_TXEMPTY);
+
+	mtcpsr(Cpsr);
+}
+
+/******************************************************************************/
+/**
+*
+* Character output used by xil_printf. The character is queued in the TX
+* ring and the TX empty interrupt is kicked if it is not running.
+*
+* @param	c is the character to be sent
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void outbyte(char c)
+{
+	u32 Cpsr;
+
+	if (!ConsoleStarted) {
+		while (ConsoleTxFull());
+		Xil_Out32(STDOUT_BASEADDRESS + XUARTPS_FIFO_OFFSET, (u32)c);
+		return;
+	}
+
+	Cpsr = mfcpsr();
+	mtcpsr(Cpsr | XIL_EXCEPTION_IRQ);
+
+	/*
+	 * Ring full, make room by writing to the FIFO directly
+	 */
+	while (((TxHead + 1) & CONSOLE_TX_BUFFER_MASK) == TxTail) {
+		ConsoleTxFill();
+	}
+
+	TxBuffer[TxHead] = (u8)c;
+	TxHead = (TxHead + 1) & CONSOLE_TX_BUFFER_MASK;
+
+	if (!TxActive) {
+		ConsoleTxFill();
+		if (TxHead != TxTail) {
+			TxActive = 1;
+			Xil_Out32(STDOUT_BASEADDRESS + XUARTPS_IER_OFFSET,
+					XUARTPS_IXR_TXEMPTY);
+		}
+	}
+
+	mtcpsr(Cpsr);
+}
+
+/******************************************************************************/
+/**
+*
+* This function moves as many characters from the ring to the UART TX FIFO
+* as the FIFO can take.
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Called with IRQ masked or from the interrupt handler.
+*
+****************************************************************************/
+static void ConsoleTxFill(void)
+{
+	while ((TxHead != TxTail) && !ConsoleTxFull()) {
+		Xil_Out32(STDOUT_BASEADDRESS + XUARTPS_FIFO_OFFSET,
+				(u32)TxBuffer[TxTail]);
+		TxTail = (TxTail + 1) & CONSOLE_TX_BUFFER_MASK;
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* UART interrupt handler, refills the TX FIFO each time it runs empty and
+* turns the interrupt off once the ring is drained.
+*
+* @param	CallBackRef is not used
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+static void ConsoleIntrHandler(void *CallBackRef)
+{
+	u32 IntrStatus;
+
+	(void)CallBackRef;
+
+	IntrStatus = Xil_In32(STDOUT_BASEADDRESS + XUARTPS_ISR_OFFSET) &
+			Xil_In32(STDOUT_BASEADDRESS + XUARTPS_IMR_OFFSET);
+	Xil_Out32(STDOUT_BASEADDRESS + XUARTPS_ISR_OFFSET, IntrStatus);
+
+	if ((IntrStatus & XUARTPS_IXR_TXEMPTY) == 0) {
+		return;
+	}
+
+	ConsoleTxFill();
+
+	if (TxHead == TxTail) {
+		Xil_Out32(STDOUT_BASEADDRESS + XUARTPS_IDR_OFFSET,
+				XUARTPS_IXR_TXEMPTY);
+		TxActive = 0;
+	}
+}
+
+#endif /* FSBL_CONSOLE_BUFFERED */
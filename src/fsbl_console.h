@@ -0,0 +1,104 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_console.h
+*
+* Contains the function prototypes and defines for the buffered,
+* interrupt driven FSBL console.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* When FSBL_CONSOLE_BUFFERED is not set all the console calls compile to
+* nothing and the output goes straight to the UART as before.
+*
+******************************************************************************/
+#ifndef ___FSBL_CONSOLE_H___
+#define ___FSBL_CONSOLE_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions *****************************/
+
+#if defined(FSBL_CONSOLE_BUFFERED) && !defined(STDOUT_BASEADDRESS)
+#undef FSBL_CONSOLE_BUFFERED
+#endif
+
+/*
+ * Size of the TX ring, must be a power of 2
+ */
+#ifndef CONSOLE_TX_BUFFER_SIZE
+#define CONSOLE_TX_BUFFER_SIZE	4096
+#endif
+
+#if (CONSOLE_TX_BUFFER_SIZE == 0) || \
+		((CONSOLE_TX_BUFFER_SIZE & (CONSOLE_TX_BUFFER_SIZE - 1)) != 0)
+#error "CONSOLE_TX_BUFFER_SIZE must be a power of 2"
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#ifdef FSBL_CONSOLE_BUFFERED
+u32 ConsoleInit(void);
+void ConsoleFlush(void);
+#else
+#define ConsoleInit()	(XST_SUCCESS)
+#define ConsoleFlush()
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___FSBL_CONSOLE_H___ */
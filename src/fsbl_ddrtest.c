@@ -0,0 +1,380 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_ddrtest.c
+*
+* Contains the boot time DDR test.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+* 1.01a hx	10/18/26	The line checks restore the words they write
+*						Added the missing March C- elements
+*						DdrTest() skips line checks that already passed
+*
+* </pre>
+*
+* @note
+*
+* The test pattern of a word is its address XORed with DDR_TEST_PATTERN,
+* so an address fault shows up as a wrong value. The march loops work on
+* one cache line at a time, the compiler turns them into LDM/STM bursts.
+* The result is added to the boot timeline as TIMELINE_DDR_TEST.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "fsbl.h"
+#include "fsbl_ddrtest.h"
+#include "fsbl_cache.h"
+#include "fsbl_timeline.h"
+#include "xil_io.h"
+#include "xpseudo_asm.h"
+#include "xtime_l.h"
+
+#ifdef XPAR_PS7_DDR_0_S_AXI_BASEADDR
+
+/************************** Constant Definitions *****************************/
+#define DDR_TEST_LINE_WORDS		8
+#define DDR_TEST_LINE_SIZE		(DDR_TEST_LINE_WORDS * 4)
+#define DDR_TEST_COUNTS_PER_US	(COUNTS_PER_SECOND / 1000000)
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * One March C- element: direction, the expected value to read (if any)
+ * and the value to write (if any), as XOR masks over the pattern
+ */
+typedef struct {
+	u8 Down;
+	u8 Read;
+	u8 Write;
+	u32 ReadXor;
+	u32 WriteXor;
+} DdrMarchElement;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define DdrTestValue(Address)	((u32)(Address) ^ DDR_TEST_PATTERN)
+
+/************************** Function Prototypes ******************************/
+static u32 DdrTestBlock(u32 Address);
+static u32 DdrTestElement(u32 Address, const DdrMarchElement *Element);
+static u32 DdrTestReverse(u32 Value, u32 Bits);
+
+/************************** Variable Definitions *****************************/
+
+/*
+ * March C-: w0, up r0 w1, up r1 w0, down r0 w1, down r1 w0, r0
+ */
+static const DdrMarchElement March[] = {
+	{0, 0, 1, 0x00000000, 0x00000000},
+	{0, 1, 1, 0x00000000, 0xFFFFFFFF},
+	{0, 1, 1, 0xFFFFFFFF, 0x00000000},
+	{1, 1, 1, 0x00000000, 0xFFFFFFFF},
+	{1, 1, 1, 0xFFFFFFFF, 0x00000000},
+	{0, 1, 0, 0x00000000, 0x00000000},
+};
+
+/*
+ * First failing address of the last test
+ */
+static u32 FailAddress;
+
+/*
+ * Words written by the line checks, saved before and written back after
+ * them: offsets 0 and 4, then the powers of two up to the DDR size
+ */
+static u32 LinesSaved[32];
+
+/*
+ * Set once the line checks passed, DdrTest() does not repeat them
+ */
+static u32 LinesPassed;
+
+/******************************************************************************/
+/**
+*
+* This function checks the DDR data and address lines: walking ones and
+* zeros on all data lines, then a unique value at every power of two
+* offset to catch address, bank and row faults.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if all the lines work
+*		- XST_FAILURE otherwise
+*
+* @note		Runs with the data cache off. Every word written is saved
+*		first and restored afterwards, so DDR contents kept over a warm
+*		reset survive.
+*
+****************************************************************************/
+u32 DdrTestLines(void)
+{
+	u32 Bit;
+	u32 Offset;
+	u32 Index;
+	u32 Size = DDR_END_ADDR - DDR_START_ADDR + 1;
+	u32 Status = XST_SUCCESS;
+
+	for (Offset = 0, Index = 0; Offset < Size;
+			Offset = (Offset < 8) ? (Offset + 4) : (Offset << 1), Index++) {
+		LinesSaved[Index] = Xil_In32(DDR_START_ADDR + Offset);
+	}
+
+	for (Bit = 0; Bit < 32; Bit++) {
+		Xil_Out32(DDR_START_ADDR, (u32)1 << Bit);
+		Xil_Out32(DDR_START_ADDR + 4, ~((u32)1 << Bit));
+		if ((Xil_In32(DDR_START_ADDR) != ((u32)1 << Bit)) ||
+				(Xil_In32(DDR_START_ADDR + 4) != ~((u32)1 << Bit))) {
+			fsbl_printf(DEBUG_INFO,"DDR data bit %d failed\r\n",Bit);
+			FailAddress = DDR_START_ADDR;
+			Status = XST_FAILURE;
+			break;
+		}
+	}
+
+	if (Status == XST_SUCCESS) {
+		for (Offset = 8; Offset < Size; Offset <<= 1) {
+			Xil_Out32(DDR_START_ADDR + Offset, DDR_TEST_PATTERN ^ Offset);
+		}
+		for (Offset = 8; Offset < Size; Offset <<= 1) {
+			if (Xil_In32(DDR_START_ADDR + Offset) !=
+					(DDR_TEST_PATTERN ^ Offset)) {
+				fsbl_printf(DEBUG_INFO,
+						"DDR address offset 0x%08x failed\r\n", Offset);
+				FailAddress = DDR_START_ADDR + Offset;
+				Status = XST_FAILURE;
+				break;
+			}
+		}
+	}
+
+	for (Offset = 0, Index = 0; Offset < Size;
+			Offset = (Offset < 8) ? (Offset + 4) : (Offset << 1), Index++) {
+		Xil_Out32(DDR_START_ADDR + Offset, LinesSaved[Index]);
+	}
+
+	LinesPassed = (Status == XST_SUCCESS);
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function runs the line checks, unless they already passed, and then
+* the march over sampled blocks until the time budget is used up or every
+* block was tested.
+*
+* @param	BudgetUs is the time budget of the march in microseconds
+*
+* @return
+*		- XST_SUCCESS if no fault was found
+*		- XST_FAILURE otherwise
+*
+* @note		The march destroys the contents of the blocks it tests, with
+*		a budget of 0 nothing is changed. The timeline entry holds the KB
+*		tested, or the failing address with Index set to 1.
+*
+****************************************************************************/
+u32 DdrTest(u32 BudgetUs)
+{
+	u32 Blocks = (DDR_END_ADDR - DDR_START_ADDR + 1) /
+			FSBL_DDR_TEST_BLOCK_SIZE;
+	u32 Bits = 0;
+	u32 Count;
+	u32 Index;
+	u32 Tested = 0;
+	u32 Status;
+	XTime Now;
+	XTime Deadline;
+
+	XTime_GetTime(&Deadline);
+	Deadline += (XTime)BudgetUs * DDR_TEST_COUNTS_PER_US;
+
+	Status = LinesPassed ? XST_SUCCESS : DdrTestLines();
+
+	while (((u32)1 << Bits) < Blocks) {
+		Bits++;
+	}
+
+	if ((Status == XST_SUCCESS) && (BudgetUs != 0)) {
+		CacheLoadEnable();
+		for (Count = 0; Count < ((u32)1 << Bits); Count++) {
+			Index = DdrTestReverse(Count, Bits);
+			if (Index >= Blocks) {
+				continue;
+			}
+			Status = DdrTestBlock(DDR_START_ADDR +
+					(Index * FSBL_DDR_TEST_BLOCK_SIZE));
+			if (Status != XST_SUCCESS) {
+				break;
+			}
+			Tested++;
+			XTime_GetTime(&Now);
+			if (Now >= Deadline) {
+				break;
+			}
+		}
+		CacheLoadDisable();
+	}
+
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"DDR test failed at 0x%08x\r\n",
+				FailAddress);
+		TimelineMark(TIMELINE_DDR_TEST, 1, FailAddress);
+		return XST_FAILURE;
+	}
+
+	fsbl_printf(DEBUG_INFO,"DDR test: %d of %d blocks\r\n", Tested, Blocks);
+	TimelineMark(TIMELINE_DDR_TEST, 0,
+			Tested * (FSBL_DDR_TEST_BLOCK_SIZE / 1024));
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function runs all the march elements over one block, each element
+* is written back to DDR and dropped from the cache before the next one.
+*
+* @param	Address is the start of the block
+*
+* @return
+*		- XST_SUCCESS if the block passed
+*		- XST_FAILURE otherwise
+*
+* @note		None
+*
+****************************************************************************/
+static u32 DdrTestBlock(u32 Address)
+{
+	u32 Element;
+
+	for (Element = 0; Element < sizeof(March) / sizeof(March[0]);
+			Element++) {
+		if (DdrTestElement(Address, &March[Element]) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		dsb();
+		CacheCleanRange(Address, FSBL_DDR_TEST_BLOCK_SIZE);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function runs one march element over a block, a cache line at a
+* time
+*
+* @param	Address is the start of the block
+* @param	Element is the march element
+*
+* @return
+*		- XST_SUCCESS if all the reads matched
+*		- XST_FAILURE otherwise, FailAddress is set
+*
+* @note		None
+*
+****************************************************************************/
+static u32 DdrTestElement(u32 Address, const DdrMarchElement *Element)
+{
+	u32 *Ptr;
+	u32 Lines = FSBL_DDR_TEST_BLOCK_SIZE / DDR_TEST_LINE_SIZE;
+	u32 Line;
+	u32 Word;
+	u32 Diff;
+
+	for (Line = 0; Line < Lines; Line++) {
+		Ptr = (u32 *)(Address + (DDR_TEST_LINE_SIZE *
+				(Element->Down ? (Lines - 1 - Line) : Line)));
+
+		if (Element->Read) {
+			Diff = 0;
+			for (Word = 0; Word < DDR_TEST_LINE_WORDS; Word++) {
+				Diff |= Ptr[Word] ^ DdrTestValue(&Ptr[Word]) ^
+						Element->ReadXor;
+			}
+			if (Diff != 0) {
+				for (Word = 0; Ptr[Word] == (DdrTestValue(&Ptr[Word]) ^
+						Element->ReadXor); Word++);
+				FailAddress = (u32)&Ptr[Word];
+				return XST_FAILURE;
+			}
+		}
+
+		if (Element->Write) {
+			for (Word = 0; Word < DDR_TEST_LINE_WORDS; Word++) {
+				Ptr[Word] = DdrTestValue(&Ptr[Word]) ^ Element->WriteXor;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function reverses the low bits of a block count, so the blocks are
+* visited spread over the whole DDR: 0, 1/2, 1/4, 3/4, ...
+*
+* @param	Value is the count to reverse
+* @param	Bits is the number of bits reversed
+*
+* @return	Reversed value
+*
+* @note		None
+*
+****************************************************************************/
+static u32 DdrTestReverse(u32 Value, u32 Bits)
+{
+	u32 Result = 0;
+
+	while (Bits--) {
+		Result = (Result << 1) | (Value & 1);
+		Value >>= 1;
+	}
+
+	return Result;
+}
+
+#endif /* XPAR_PS7_DDR_0_S_AXI_BASEADDR */
@@ -0,0 +1,99 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_ddrtest.h
+*
+* Contains the interface of the boot time DDR test.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* DdrTestLines() checks the data lines with walking ones and zeros and the
+* address lines with a unique value at every power of two offset. DdrTest()
+* adds a March C- over blocks of FSBL_DDR_TEST_BLOCK_SIZE bytes, sampled
+* over the whole DDR in bit reversed order, for as many blocks as fit in
+* the time budget. With FSBL_CACHED_LOAD the march runs with the data cache
+* on and every element is written back and invalidated, so DDR sees full
+* line bursts.
+*
+******************************************************************************/
+#ifndef ___FSBL_DDRTEST_H___
+#define ___FSBL_DDRTEST_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Time budget of the march in microseconds, 0 runs the line checks only
+ */
+#ifndef FSBL_DDR_TEST_BUDGET_US
+#define FSBL_DDR_TEST_BUDGET_US		5000
+#endif
+
+/*
+ * Bytes per sampled block, a power of 2 and a multiple of the cache line
+ */
+#ifndef FSBL_DDR_TEST_BLOCK_SIZE
+#define FSBL_DDR_TEST_BLOCK_SIZE	4096
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+u32 DdrTestLines(void);
+u32 DdrTest(u32 BudgetUs);
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___FSBL_DDRTEST_H___ */
@@ -0,0 +1,599 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_dma.c
+*
+* Contains the PS DMA controller (PL330) copy service, compiled with
+* FSBL_DMA_COPY.
+*
+* Each copy is a small microcode program built into the program buffer of
+* a channel and started with DMAGO through the debug interface of the
+* secure DMAC. The programs use incrementing bursts of 16 beats, the beat
+* size is the largest of 8, 4, 2 or 1 bytes the source and destination
+* can be aligned to together. The bytes before the first aligned beat and
+* after the last one are moved as single byte beats, so any length and
+* alignment is handled by the DMAC.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* A copy longer than DMA_MAX_BURSTS bursts is split over several channels,
+* which then run at the same time. The source and destination are cleaned
+* from the data cache before the start and the destination is invalidated
+* when DmaWait finds the channel stopped.
+*
+* tools/pl330_check.py builds DmaBuild on the host and checks the programs
+* it emits for random alignments and lengths.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "fsbl_dma.h"
+
+#ifdef FSBL_DMA_COPY
+
+#include "fsbl.h"
+#include "fsbl_cache.h"
+#include "fsbl_poll.h"
+#include "xil_io.h"
+
+/************************** Constant Definitions *****************************/
+#define DMA_BASEADDR			XPS_DMAC0_SEC_BASEADDR
+
+/*
+ * DMAC registers
+ */
+#define DMA_DS_OFFSET			0x000
+#define DMA_FTR_OFFSET(n)		(0x040 + ((n) * 4))
+#define DMA_CSR_OFFSET(n)		(0x100 + ((n) * 8))
+#define DMA_DBGSTATUS_OFFSET	0xD00
+#define DMA_DBGCMD_OFFSET		0xD04
+#define DMA_DBGINST0_OFFSET		0xD08
+#define DMA_DBGINST1_OFFSET		0xD0C
+
+#define DMA_STATE_MASK			0xF
+#define DMA_STATE_STOPPED		0x0
+#define DMA_STATE_FAULT_COMPL	0xE
+#define DMA_STATE_FAULTING		0xF
+#define DMA_DBG_BUSY			0x1
+#define DMA_DBG_CHANNEL			0x1
+
+/*
+ * SLCR clock and reset of the DMAC
+ */
+#define DMA_SLCR_APER_CLK_OFFSET	0x12C
+#define DMA_SLCR_RST_OFFSET			0x20C
+#define DMA_CPU_2X_CLKACT			0x1
+
+/*
+ * Instructions
+ */
+#define DMA_INSN_END			0x00
+#define DMA_INSN_KILL			0x01
+#define DMA_INSN_LD				0x04
+#define DMA_INSN_ST				0x08
+#define DMA_INSN_WMB			0x13
+#define DMA_INSN_LP				0x20
+#define DMA_INSN_LPEND			0x38
+#define DMA_INSN_GO				0xA0
+#define DMA_INSN_MOV			0xBC
+
+#define DMA_REG_SAR				0
+#define DMA_REG_CCR				1
+#define DMA_REG_DAR				2
+
+/*
+ * Channel control, incrementing addresses and bufferable accesses
+ */
+#define DMA_CCR_SRC_INC			0x00000001
+#define DMA_CCR_SRC_SIZE_SHIFT	1
+#define DMA_CCR_SRC_LEN_SHIFT	4
+#define DMA_CCR_SRC_BUFFERABLE	0x00000800
+#define DMA_CCR_DST_INC			0x00004000
+#define DMA_CCR_DST_SIZE_SHIFT	15
+#define DMA_CCR_DST_LEN_SHIFT	18
+#define DMA_CCR_DST_BUFFERABLE	0x02000000
+
+#define DMA_BURST_BEATS			16
+#define DMA_LOOP_MAX			256
+
+/*
+ * Outer loops per program, a program moves at most DMA_MAX_BURSTS bursts
+ */
+#define DMA_MAX_BLOCKS			4
+#define DMA_MAX_BURSTS			(DMA_MAX_BLOCKS * DMA_LOOP_MAX * DMA_LOOP_MAX)
+
+/*
+ * Three moves, four CCR moves with their loops and the outer blocks
+ */
+#define DMA_PROGRAM_SIZE		128
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u8 Program[DMA_PROGRAM_SIZE] __attribute__ ((aligned(32)));
+	u32 Busy;
+	u32 Destination;
+	u32 Length;
+} DmaChannel;
+
+typedef struct {
+	u8 *Buf;
+	u32 Len;
+} DmaProgram;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define DmaCcr(Shift, Beats) \
+	(DMA_CCR_SRC_INC | ((Shift) << DMA_CCR_SRC_SIZE_SHIFT) | \
+	(((Beats) - 1) << DMA_CCR_SRC_LEN_SHIFT) | DMA_CCR_SRC_BUFFERABLE | \
+	DMA_CCR_DST_INC | ((Shift) << DMA_CCR_DST_SIZE_SHIFT) | \
+	(((Beats) - 1) << DMA_CCR_DST_LEN_SHIFT) | DMA_CCR_DST_BUFFERABLE)
+
+/************************** Function Prototypes ******************************/
+static u32 DmaBuild(DmaProgram *Prog, u32 SourceAddress,
+		u32 DestinationAddress, u32 Length);
+static void DmaEmit(DmaProgram *Prog, u32 Byte);
+static void DmaEmitMov(DmaProgram *Prog, u32 Reg, u32 Value);
+static void DmaEmitCopy(DmaProgram *Prog, u32 Count);
+static u32 DmaDebugExec(u32 Insn, u32 Channel, u32 Thread, u32 Address);
+static u32 DmaChannelWait(u32 Index);
+
+/************************** Variable Definitions *****************************/
+static DmaChannel Channels[DMA_CHANNEL_COUNT];
+static u32 NextChannel;
+static u32 DmaReady;
+
+/*
+ * Set when a channel failed since the last DmaWait
+ */
+static u32 DmaError;
+
+/******************************************************************************/
+/**
+*
+* This function turns on the DMAC clock, releases its reset and checks the
+* manager thread.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the DMAC can be used
+*		- XST_FAILURE if the manager is faulting, the copies are then
+*		  done by the CPU
+*
+* @note		The SLCR must be unlocked.
+*
+****************************************************************************/
+u32 DmaInit(void)
+{
+	Xil_Out32(XPS_SYS_CTRL_BASEADDR + DMA_SLCR_APER_CLK_OFFSET,
+			Xil_In32(XPS_SYS_CTRL_BASEADDR + DMA_SLCR_APER_CLK_OFFSET) |
+			DMA_CPU_2X_CLKACT);
+	Xil_Out32(XPS_SYS_CTRL_BASEADDR + DMA_SLCR_RST_OFFSET, 0);
+
+	if ((Xil_In32(DMA_BASEADDR + DMA_DS_OFFSET) & DMA_STATE_MASK) ==
+			DMA_STATE_FAULTING) {
+		fsbl_printf(DEBUG_GENERAL,"DMAC manager faulting\r\n");
+		return XST_FAILURE;
+	}
+
+	NextChannel = 0;
+	DmaError = 0;
+	DmaReady = 1;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function starts a copy on the DMAC and returns without waiting for it
+*
+* @param	SourceAddress is the start of the source
+* @param	DestinationAddress is the start of the destination
+* @param	Length is the number of bytes to copy
+*
+* @return
+*		- XST_SUCCESS if the copy is started or done
+*		- XST_FAILURE if a channel could not be started
+*
+* @note		When all the channels are busy the oldest one is waited for.
+*		The destination must not be read before DmaWait.
+*
+****************************************************************************/
+u32 DmaCopyAsync(u32 SourceAddress, u32 DestinationAddress, u32 Length)
+{
+	DmaChannel *Channel;
+	DmaProgram Prog;
+	u32 Done;
+
+	if (!DmaReady || (Length < DMA_MIN_BYTES)) {
+		memcpy((void *)DestinationAddress, (const void *)SourceAddress,
+				Length);
+		return XST_SUCCESS;
+	}
+
+	CacheCleanRange(SourceAddress, Length);
+	CacheCleanRange(DestinationAddress, Length);
+
+	while (Length > 0) {
+		Channel = &Channels[NextChannel];
+		if (Channel->Busy && (DmaChannelWait(NextChannel) != XST_SUCCESS)) {
+			DmaError = 1;
+		}
+
+		Prog.Buf = Channel->Program;
+		Prog.Len = 0;
+		Done = DmaBuild(&Prog, SourceAddress, DestinationAddress, Length);
+		CacheCleanRange((u32)Channel->Program, Prog.Len);
+
+		if (DmaDebugExec(DMA_INSN_GO | (NextChannel << 8), 0, 0,
+				(u32)Channel->Program) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		if ((Xil_In32(DMA_BASEADDR + DMA_DS_OFFSET) & DMA_STATE_MASK) ==
+				DMA_STATE_FAULTING) {
+			fsbl_printf(DEBUG_GENERAL,"DMAC manager faulting\r\n");
+			DmaDebugExec(DMA_INSN_KILL, 0, 0, 0);
+			return XST_FAILURE;
+		}
+
+		Channel->Busy = 1;
+		Channel->Destination = DestinationAddress;
+		Channel->Length = Done;
+		NextChannel = (NextChannel + 1) % DMA_CHANNEL_COUNT;
+
+		SourceAddress += Done;
+		DestinationAddress += Done;
+		Length -= Done;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits until all the copies started by DmaCopyAsync are done
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if all the copies completed
+*		- XST_FAILURE if a channel faulted or timed out
+*
+* @note		None
+*
+****************************************************************************/
+u32 DmaWait(void)
+{
+	u32 Index;
+	u32 Status;
+
+	for (Index = 0; Index < DMA_CHANNEL_COUNT; Index++) {
+		if (Channels[Index].Busy &&
+				(DmaChannelWait(Index) != XST_SUCCESS)) {
+			DmaError = 1;
+		}
+	}
+
+	Status = DmaError ? XST_FAILURE : XST_SUCCESS;
+	DmaError = 0;
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function builds the microcode of one copy, as much of it as one
+* program can move
+*
+* @param	Prog is the program to build
+* @param	SourceAddress is the start of the source
+* @param	DestinationAddress is the start of the destination
+* @param	Length is the number of bytes left to copy
+*
+* @return	Number of bytes the program moves
+*
+* @note		None
+*
+****************************************************************************/
+static u32 DmaBuild(DmaProgram *Prog, u32 SourceAddress,
+		u32 DestinationAddress, u32 Length)
+{
+	u32 Shift = 3;
+	u32 Size;
+	u32 Done = 0;
+	u32 Count;
+	u32 Bursts;
+	u32 Tail;
+	u32 Outer;
+	u32 Loop0;
+	u32 Loop1;
+
+	/*
+	 * Beat size both addresses can be aligned to
+	 */
+	while ((Shift > 0) &&
+			(((SourceAddress ^ DestinationAddress) & ((1 << Shift) - 1)) != 0)) {
+		Shift--;
+	}
+	Size = 1 << Shift;
+
+	DmaEmitMov(Prog, DMA_REG_SAR, SourceAddress);
+	DmaEmitMov(Prog, DMA_REG_DAR, DestinationAddress);
+
+	/*
+	 * Bytes up to the first aligned beat
+	 */
+	Count = (Size - (SourceAddress & (Size - 1))) & (Size - 1);
+	if (Count > Length) {
+		Count = Length;
+	}
+	if (Count != 0) {
+		DmaEmitMov(Prog, DMA_REG_CCR, DmaCcr(0, 1));
+		DmaEmitCopy(Prog, Count);
+		Done += Count;
+	}
+
+	/*
+	 * Bursts, DMA_LOOP_MAX * DMA_LOOP_MAX at a time in the outer loops
+	 */
+	Bursts = (Length - Done) / (Size * DMA_BURST_BEATS);
+	Tail = (Bursts <= DMA_MAX_BURSTS);
+	if (!Tail) {
+		Bursts = DMA_MAX_BURSTS;
+	}
+	if (Bursts != 0) {
+		DmaEmitMov(Prog, DMA_REG_CCR, DmaCcr(Shift, DMA_BURST_BEATS));
+		Done += Bursts * Size * DMA_BURST_BEATS;
+
+		while (Bursts >= DMA_LOOP_MAX) {
+			Outer = Bursts / DMA_LOOP_MAX;
+			if (Outer > DMA_LOOP_MAX) {
+				Outer = DMA_LOOP_MAX;
+			}
+			DmaEmit(Prog, DMA_INSN_LP | 0x2);
+			DmaEmit(Prog, Outer - 1);
+			Loop1 = Prog->Len;
+			DmaEmit(Prog, DMA_INSN_LP);
+			DmaEmit(Prog, DMA_LOOP_MAX - 1);
+			Loop0 = Prog->Len;
+			DmaEmit(Prog, DMA_INSN_LD);
+			DmaEmit(Prog, DMA_INSN_ST);
+			DmaEmit(Prog, DMA_INSN_LPEND);
+			DmaEmit(Prog, Prog->Len - 1 - Loop0);
+			DmaEmit(Prog, DMA_INSN_LPEND | 0x4);
+			DmaEmit(Prog, Prog->Len - 1 - Loop1);
+			Bursts -= Outer * DMA_LOOP_MAX;
+		}
+		DmaEmitCopy(Prog, Bursts);
+	}
+
+	/*
+	 * Single beats and bytes after the last burst, unless the next
+	 * program goes on with the bursts
+	 */
+	if (Tail && (Done != Length)) {
+		Count = (Length - Done) / Size;
+		if ((Count != 0) && (Size != 1)) {
+			DmaEmitMov(Prog, DMA_REG_CCR, DmaCcr(Shift, 1));
+			DmaEmitCopy(Prog, Count);
+			Done += Count * Size;
+		}
+
+		Count = Length - Done;
+		if (Count != 0) {
+			DmaEmitMov(Prog, DMA_REG_CCR, DmaCcr(0, 1));
+			DmaEmitCopy(Prog, Count);
+			Done += Count;
+		}
+	}
+
+	DmaEmit(Prog, DMA_INSN_WMB);
+	DmaEmit(Prog, DMA_INSN_END);
+
+	return Done;
+}
+
+/******************************************************************************/
+/**
+*
+* This function adds a byte to a program
+*
+* @param	Prog is the program
+* @param	Byte is the byte to add
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+static void DmaEmit(DmaProgram *Prog, u32 Byte)
+{
+	Prog->Buf[Prog->Len++] = (u8)Byte;
+}
+
+/******************************************************************************/
+/**
+*
+* This function adds a DMAMOV
+*
+* @param	Prog is the program
+* @param	Reg is DMA_REG_SAR, DMA_REG_CCR or DMA_REG_DAR
+* @param	Value is the value moved
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+static void DmaEmitMov(DmaProgram *Prog, u32 Reg, u32 Value)
+{
+	DmaEmit(Prog, DMA_INSN_MOV);
+	DmaEmit(Prog, Reg);
+	DmaEmit(Prog, Value);
+	DmaEmit(Prog, Value >> 8);
+	DmaEmit(Prog, Value >> 16);
+	DmaEmit(Prog, Value >> 24);
+}
+
+/******************************************************************************/
+/**
+*
+* This function adds Count load and store pairs with the current CCR
+*
+* @param	Prog is the program
+* @param	Count is the number of pairs, below DMA_LOOP_MAX + 1
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+static void DmaEmitCopy(DmaProgram *Prog, u32 Count)
+{
+	u32 Loop;
+
+	if (Count == 0) {
+		return;
+	}
+
+	if (Count > 1) {
+		DmaEmit(Prog, DMA_INSN_LP);
+		DmaEmit(Prog, Count - 1);
+	}
+	Loop = Prog->Len;
+	DmaEmit(Prog, DMA_INSN_LD);
+	DmaEmit(Prog, DMA_INSN_ST);
+	if (Count > 1) {
+		DmaEmit(Prog, DMA_INSN_LPEND);
+		DmaEmit(Prog, Prog->Len - 1 - Loop);
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function executes an instruction through the debug interface
+*
+* @param	Insn holds the first two instruction bytes
+* @param	Channel is the channel of a channel thread instruction
+* @param	Thread is DMA_DBG_CHANNEL for a channel thread, 0 for the
+*		manager
+* @param	Address is the DMAGO program address
+*
+* @return
+*		- XST_SUCCESS if the instruction was executed
+*		- XST_FAILURE if the debug interface stayed busy
+*
+* @note		None
+*
+****************************************************************************/
+static u32 DmaDebugExec(u32 Insn, u32 Channel, u32 Thread, u32 Address)
+{
+	u32 Status;
+
+	Status = PollMask(POLL_SITE_DMA_DONE, DMA_BASEADDR + DMA_DBGSTATUS_OFFSET,
+			DMA_DBG_BUSY, 0);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Xil_Out32(DMA_BASEADDR + DMA_DBGINST0_OFFSET,
+			(Insn << 16) | (Channel << 8) | Thread);
+	Xil_Out32(DMA_BASEADDR + DMA_DBGINST1_OFFSET, Address);
+	Xil_Out32(DMA_BASEADDR + DMA_DBGCMD_OFFSET, 0);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for a channel to stop, kills it if it faulted and
+* invalidates its destination once the copy completed
+*
+* @param	Index is the channel
+*
+* @return
+*		- XST_SUCCESS if the copy completed
+*		- XST_FAILURE on a fault or after FSBL_POLL_DMA_DONE_US
+*
+* @note		None
+*
+****************************************************************************/
+static u32 DmaChannelWait(u32 Index)
+{
+	DmaChannel *Channel = &Channels[Index];
+	PollDeadline Poll;
+	u32 State;
+	u32 Status = XST_SUCCESS;
+
+	PollStart(&Poll, POLL_SITE_DMA_DONE);
+	do {
+		State = Xil_In32(DMA_BASEADDR + DMA_CSR_OFFSET(Index)) &
+				DMA_STATE_MASK;
+		if ((State == DMA_STATE_STOPPED) ||
+				(State >= DMA_STATE_FAULT_COMPL)) {
+			break;
+		}
+	} while (!PollExpired(&Poll));
+	PollEnd(&Poll);
+
+	if (State != DMA_STATE_STOPPED) {
+		fsbl_printf(DEBUG_GENERAL,"DMA channel %d state 0x%x fault 0x%08x\r\n",
+				Index, State,
+				Xil_In32(DMA_BASEADDR + DMA_FTR_OFFSET(Index)));
+		DmaDebugExec(DMA_INSN_KILL, Index, DMA_DBG_CHANNEL, 0);
+		Status = XST_FAILURE;
+	} else {
+		CacheInvalidateRange(Channel->Destination, Channel->Length);
+	}
+
+	Channel->Busy = 0;
+
+	return Status;
+}
+
+#endif /* FSBL_DMA_COPY */
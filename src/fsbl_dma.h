@@ -0,0 +1,108 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_dma.h
+*
+* Contains the interface of the PS DMA controller (PL330) copy service.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* With FSBL_DMA_COPY a copy started by DmaCopyAsync runs on a free DMAC
+* channel while the caller goes on, DmaWait waits for all of them. Up to
+* DMA_CHANNEL_COUNT copies run at the same time. Without the flag, before
+* DmaInit and for copies shorter than DMA_MIN_BYTES the data is copied by
+* the CPU before DmaCopyAsync returns.
+*
+******************************************************************************/
+#ifndef ___FSBL_DMA_H___
+#define ___FSBL_DMA_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Copies shorter than this are done by the CPU
+ */
+#ifndef DMA_MIN_BYTES
+#define DMA_MIN_BYTES		256
+#endif
+
+/*
+ * DMAC channels used for the copies, at most 8
+ */
+#ifndef DMA_CHANNEL_COUNT
+#define DMA_CHANNEL_COUNT	8
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#ifdef FSBL_DMA_COPY
+u32 DmaInit(void);
+u32 DmaCopyAsync(u32 SourceAddress, u32 DestinationAddress, u32 Length);
+u32 DmaWait(void);
+#else
+#define DmaInit()		(XST_SUCCESS)
+#define DmaCopyAsync(SourceAddress, DestinationAddress, Length) \
+	(memcpy((void *)(DestinationAddress), (const void *)(SourceAddress), \
+			(Length)), XST_SUCCESS)
+#define DmaWait()		(XST_SUCCESS)
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___FSBL_DMA_H___ */
@@ -0,0 +1,229 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_pmu.c
+*
+* Contains the PMU based scope profiling enabled with FSBL_PMU.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* Refer to fsbl_pmu.h for the scope identifiers and the events counted.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "fsbl_pmu.h"
+
+#ifdef FSBL_PMU
+
+#include "fsbl.h"
+#include "xpseudo_asm.h"
+#include "xreg_cortexa9.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * PMCR bits
+ */
+#define PMU_PMCR_ENABLE			0x1
+#define PMU_PMCR_EVENT_RESET	0x2
+#define PMU_PMCR_CCNT_RESET		0x4
+
+/*
+ * PMCNTENSET bits, event counters 0 and 1 and CCNT
+ */
+#define PMU_CNTEN_MASK			0x80000003
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u32 StartCycles;
+	u32 StartEvent0;
+	u32 StartEvent1;
+	u32 Calls;
+	u64 Cycles;
+	u64 Event0;
+	u64 Event1;
+} PmuScope;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 PmuReadEvent(u32 Counter);
+
+/************************** Variable Definitions *****************************/
+static PmuScope Scope[PMU_SCOPE_COUNT];
+
+static const char *ScopeName[PMU_SCOPE_COUNT] = {
+	"QspiAccess",
+	"NandAccess",
+	"NorAccess",
+	"SDAccess",
+	"md5",
+	"sha_256",
+	"rsa2048_pubexp",
+	"XDcfgPollDone",
+	"XQspiPs_PolledTransfer",
+};
+
+/******************************************************************************/
+/**
+*
+* This function resets and starts the cycle counter and the two event
+* counters.
+*
+* @param	None
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void PmuInit(void)
+{
+	mtcp(XREG_CP15_EVENT_CNTR_SEL, 0);
+	mtcp(XREG_CP15_EVENT_TYPE_SEL, FSBL_PMU_EVENT0);
+	mtcp(XREG_CP15_EVENT_CNTR_SEL, 1);
+	mtcp(XREG_CP15_EVENT_TYPE_SEL, FSBL_PMU_EVENT1);
+
+	mtcp(XREG_CP15_PERF_MONITOR_CTRL, PMU_PMCR_ENABLE |
+			PMU_PMCR_EVENT_RESET | PMU_PMCR_CCNT_RESET);
+	mtcp(XREG_CP15_COUNT_ENABLE_SET, PMU_CNTEN_MASK);
+}
+
+/******************************************************************************/
+/**
+*
+* This function takes the counter snapshot at the start of a scope
+*
+* @param	Id is the scope identifier
+*
+* @return	None
+*
+* @note		Use PMU_SCOPE_BEGIN instead of calling this directly
+*
+****************************************************************************/
+void PmuScopeBegin(u32 Id)
+{
+	PmuScope *ScopePtr = &Scope[Id];
+
+	ScopePtr->StartEvent0 = PmuReadEvent(0);
+	ScopePtr->StartEvent1 = PmuReadEvent(1);
+	ScopePtr->StartCycles = mfcp(XREG_CP15_PERF_CYCLE_COUNTER);
+}
+
+/******************************************************************************/
+/**
+*
+* This function adds the counts since the matching PmuScopeBegin to the
+* scope totals
+*
+* @param	Id is the scope identifier
+*
+* @return	None
+*
+* @note		Use PMU_SCOPE_END instead of calling this directly
+*
+****************************************************************************/
+void PmuScopeEnd(u32 Id)
+{
+	PmuScope *ScopePtr = &Scope[Id];
+	u32 Cycles;
+
+	Cycles = mfcp(XREG_CP15_PERF_CYCLE_COUNTER);
+
+	ScopePtr->Cycles += (u32)(Cycles - ScopePtr->StartCycles);
+	ScopePtr->Event0 += (u32)(PmuReadEvent(0) - ScopePtr->StartEvent0);
+	ScopePtr->Event1 += (u32)(PmuReadEvent(1) - ScopePtr->StartEvent1);
+	ScopePtr->Calls++;
+}
+
+/******************************************************************************/
+/**
+*
+* This function prints the totals of every scope that was entered
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Counts are printed in units of 1000
+*
+****************************************************************************/
+void PmuReport(void)
+{
+	u32 Id;
+
+	fsbl_printf(DEBUG_GENERAL, "PMU scope totals (x1000), events "
+			"0x%x/0x%x\r\n", FSBL_PMU_EVENT0, FSBL_PMU_EVENT1);
+
+	for (Id = 0; Id < PMU_SCOPE_COUNT; Id++) {
+		if (Scope[Id].Calls == 0) {
+			continue;
+		}
+		fsbl_printf(DEBUG_GENERAL, "%s: calls %d cycles %d "
+				"ev0 %d ev1 %d\r\n", ScopeName[Id], Scope[Id].Calls,
+				(u32)(Scope[Id].Cycles / 1000),
+				(u32)(Scope[Id].Event0 / 1000),
+				(u32)(Scope[Id].Event1 / 1000));
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads one of the event counters
+*
+* @param	Counter is the event counter number
+*
+* @return	Counter value
+*
+* @note		None
+*
+****************************************************************************/
+static u32 PmuReadEvent(u32 Counter)
+{
+	mtcp(XREG_CP15_EVENT_CNTR_SEL, Counter);
+	return mfcp(XREG_CP15_PERF_MONITOR_COUNT);
+}
+
+#endif /* FSBL_PMU */
@@ -0,0 +1,125 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_pmu.h
+*
+* Contains the scope macros used to profile the FSBL hot paths with the
+* Cortex-A9 performance monitor unit.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* When FSBL_PMU is not set the scope macros expand to nothing.
+*
+* Each scope counts CPU cycles (CCNT) and the two events selected with
+* FSBL_PMU_EVENT0 and FSBL_PMU_EVENT1. A scope may be nested inside a
+* different scope but must not be entered again before it ends. CCNT is a
+* 32 bit counter, a single pass through a scope longer than 2^32 cycles is
+* not measured correctly.
+*
+******************************************************************************/
+#ifndef ___FSBL_PMU_H___
+#define ___FSBL_PMU_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Cortex-A9 event numbers counted along with the cycles
+ * Default is data cache refill (0x03) and data cache dependent stall
+ * cycles (0x61)
+ */
+#ifndef FSBL_PMU_EVENT0
+#define FSBL_PMU_EVENT0		0x03
+#endif
+#ifndef FSBL_PMU_EVENT1
+#define FSBL_PMU_EVENT1		0x61
+#endif
+
+/*
+ * Scope identifiers
+ */
+#define PMU_SCOPE_QSPI_ACCESS		0
+#define PMU_SCOPE_NAND_ACCESS		1
+#define PMU_SCOPE_NOR_ACCESS		2
+#define PMU_SCOPE_SD_ACCESS			3
+#define PMU_SCOPE_MD5				4
+#define PMU_SCOPE_SHA256			5
+#define PMU_SCOPE_RSA_PUBEXP		6
+#define PMU_SCOPE_DCFG_POLL_DONE	7
+#define PMU_SCOPE_QSPI_POLLED_XFER	8
+#define PMU_SCOPE_COUNT				9
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#ifdef FSBL_PMU
+#define PMU_SCOPE_BEGIN(Id)		PmuScopeBegin(Id)
+#define PMU_SCOPE_END(Id)		PmuScopeEnd(Id)
+#else
+#define PMU_SCOPE_BEGIN(Id)
+#define PMU_SCOPE_END(Id)
+#define PmuInit()
+#define PmuReport()
+#endif
+
+/************************** Function Prototypes ******************************/
+#ifdef FSBL_PMU
+void PmuInit(void);
+void PmuScopeBegin(u32 Id);
+void PmuScopeEnd(u32 Id);
+void PmuReport(void);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___FSBL_PMU_H___ */
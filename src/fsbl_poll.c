@@ -0,0 +1,266 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_poll.c
+*
+* Contains the deadline based poll and the per site wait statistics.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+* 1.01a hx	10/18/26	Added the NAND ready site
+* 1.02a hx	10/18/26	Added the DMA done site
+* 1.03a hx	10/18/26	Added the SD command and SD ready sites
+* 1.04a hx	10/18/26	Added the SD DMA done site
+* 1.05a hx	10/18/26	Added the QSPI write site
+*
+* </pre>
+*
+* @note
+*
+* Refer to fsbl_poll.h for the wait sites and their budgets.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "fsbl.h"
+#include "fsbl_poll.h"
+#include "fsbl_timeline.h"
+#include "xil_io.h"
+
+/************************** Constant Definitions *****************************/
+#define POLL_COUNTS_PER_US	(COUNTS_PER_SECOND / 1000000)
+
+/*
+ * Global timer enable bit
+ */
+#define POLL_GTIMER_ENABLE	0x1
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u32 Calls;
+	u32 Timeouts;
+	XTime Total;
+	XTime Max;
+} PollSiteStats;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static PollSiteStats SiteStats[POLL_SITE_COUNT];
+
+static const u32 SiteBudgetUs[POLL_SITE_COUNT] = {
+	FSBL_POLL_PS7_MASKPOLL_US,
+	FSBL_POLL_PS7_PLL_LOCK_US,
+	FSBL_POLL_DCFG_DMA_DONE_US,
+	FSBL_POLL_DCFG_PCFG_DONE_US,
+	FSBL_POLL_NAND_READY_US,
+	FSBL_POLL_DMA_DONE_US,
+	FSBL_POLL_SD_CMD_US,
+	FSBL_POLL_SD_READY_US,
+	FSBL_POLL_SD_DMA_US,
+	FSBL_POLL_QSPI_WRITE_US,
+};
+
+static const char *SiteName[POLL_SITE_COUNT] = {
+	"ps7 mask poll",
+	"ps7 PLL lock",
+	"PCAP DMA done",
+	"PCAP PCFG done",
+	"NAND ready",
+	"DMA done",
+	"SD command",
+	"SD ready",
+	"SD DMA done",
+	"QSPI write",
+};
+
+/******************************************************************************/
+/**
+*
+* This function starts a wait at a site, the deadline is the current global
+* timer value plus the budget of the site.
+*
+* @param	Poll is the wait to start
+* @param	Site is one of the POLL_SITE_* identifiers
+*
+* @return	None
+*
+* @note		The global timer is started if it is not running, keeping its
+*		count
+*
+****************************************************************************/
+void PollStart(PollDeadline *Poll, u32 Site)
+{
+	u32 Control;
+
+	Control = Xil_In32(GLOBAL_TMR_BASEADDR + GTIMER_CONTROL_OFFSET);
+	if ((Control & POLL_GTIMER_ENABLE) == 0) {
+		Xil_Out32(GLOBAL_TMR_BASEADDR + GTIMER_CONTROL_OFFSET,
+				Control | POLL_GTIMER_ENABLE);
+	}
+
+	XTime_GetTime(&Poll->Start);
+	Poll->Deadline = Poll->Start +
+			(XTime)SiteBudgetUs[Site] * POLL_COUNTS_PER_US;
+	Poll->Site = Site;
+	Poll->TimedOut = 0;
+}
+
+/******************************************************************************/
+/**
+*
+* This function checks a wait against its deadline
+*
+* @param	Poll is the wait started with PollStart
+*
+* @return	1 once the deadline has passed, 0 otherwise
+*
+* @note		None
+*
+****************************************************************************/
+u32 PollExpired(PollDeadline *Poll)
+{
+	XTime Now;
+
+	XTime_GetTime(&Now);
+	if (Now >= Poll->Deadline) {
+		Poll->TimedOut = 1;
+	}
+
+	return Poll->TimedOut;
+}
+
+/******************************************************************************/
+/**
+*
+* This function ends a wait and adds the time spent to the statistics of
+* its site
+*
+* @param	Poll is the wait started with PollStart
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void PollEnd(PollDeadline *Poll)
+{
+	PollSiteStats *Stats = &SiteStats[Poll->Site];
+	XTime Now;
+
+	XTime_GetTime(&Now);
+	Now -= Poll->Start;
+
+	Stats->Calls++;
+	Stats->Total += Now;
+	if (Now > Stats->Max) {
+		Stats->Max = Now;
+	}
+	if (Poll->TimedOut) {
+		Stats->Timeouts++;
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits until the masked register value equals Value or the
+* budget of the site runs out
+*
+* @param	Site is one of the POLL_SITE_* identifiers
+* @param	Address is the register address
+* @param	Mask selects the bits compared
+* @param	Value is the expected value of the masked bits
+*
+* @return
+*		- XST_SUCCESS if the value was read before the deadline
+*		- XST_FAILURE on timeout
+*
+* @note		None
+*
+****************************************************************************/
+u32 PollMask(u32 Site, u32 Address, u32 Mask, u32 Value)
+{
+	PollDeadline Poll;
+	u32 Status = XST_SUCCESS;
+
+	PollStart(&Poll, Site);
+	while ((Xil_In32(Address) & Mask) != Value) {
+		if (PollExpired(&Poll)) {
+			Status = XST_FAILURE;
+			break;
+		}
+	}
+	PollEnd(&Poll);
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function prints the wait statistics of every site that was used and
+* adds the total wait time of each to the boot timeline
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Called before handoff
+*
+****************************************************************************/
+void PollReport(void)
+{
+	PollSiteStats *Stats;
+	u32 Site;
+	u32 TotalUs;
+
+	for (Site = 0; Site < POLL_SITE_COUNT; Site++) {
+		Stats = &SiteStats[Site];
+		if (Stats->Calls == 0) {
+			continue;
+		}
+		TotalUs = (u32)(Stats->Total / POLL_COUNTS_PER_US);
+		fsbl_printf(DEBUG_INFO, "Wait %s: %d calls %d us max %d us "
+				"timeouts %d\r\n", SiteName[Site], Stats->Calls, TotalUs,
+				(u32)(Stats->Max / POLL_COUNTS_PER_US), Stats->Timeouts);
+		TimelineMark(TIMELINE_POLL_WAIT, Site, TotalUs);
+	}
+}
@@ -0,0 +1,153 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_poll.h
+*
+* Contains the deadline based poll used for the hardware waits, and the
+* wait sites it keeps statistics for.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+* 1.01a hx	10/18/26	Added the NAND ready site
+* 1.02a hx	10/18/26	Added the DMA done site
+* 1.03a hx	10/18/26	Added the SD command and SD ready sites
+* 1.04a hx	10/18/26	Added the SD DMA done site
+* 1.05a hx	10/18/26	Added the QSPI write site
+*
+* </pre>
+*
+* @note
+*
+* A poll runs against a deadline on the global timer instead of an
+* iteration count, so its timeout does not depend on the CPU clock or on
+* the cache state. Each wait site has its own budget in microseconds, see
+* the FSBL_POLL_*_US settings below. The time spent waiting, the number of
+* waits and the timeouts are kept per site and reported by PollReport().
+*
+* The budgets are converted with COUNTS_PER_SECOND. Before the ARM PLL
+* leaves bypass the global timer runs from PS_CLK, so the waits of the
+* ps7_init PLL stage take longer in real time than their budget and are
+* reported shorter than they were.
+*
+******************************************************************************/
+#ifndef ___FSBL_POLL_H___
+#define ___FSBL_POLL_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xtime_l.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Wait sites
+ */
+#define POLL_SITE_PS7_MASKPOLL		0 /**< ps7_init mask polls */
+#define POLL_SITE_PS7_PLL_LOCK		1 /**< ps7_init PLL lock */
+#define POLL_SITE_DCFG_DMA_DONE		2 /**< PCAP DMA done */
+#define POLL_SITE_DCFG_PCFG_DONE	3 /**< PL configuration done */
+#define POLL_SITE_NAND_READY		4 /**< NAND ready after a command */
+#define POLL_SITE_DMA_DONE			5 /**< DMAC copy done */
+#define POLL_SITE_SD_CMD			6 /**< SD command and data */
+#define POLL_SITE_SD_READY			7 /**< SD card power up */
+#define POLL_SITE_SD_DMA			8 /**< SD ADMA2 read done */
+#define POLL_SITE_QSPI_WRITE		9 /**< QSPI erase and program */
+#define POLL_SITE_COUNT				10
+
+/*
+ * Timeout budget of each site in microseconds
+ */
+#ifndef FSBL_POLL_PS7_MASKPOLL_US
+#define FSBL_POLL_PS7_MASKPOLL_US	100000
+#endif
+#ifndef FSBL_POLL_PS7_PLL_LOCK_US
+#define FSBL_POLL_PS7_PLL_LOCK_US	100000
+#endif
+#ifndef FSBL_POLL_DCFG_DMA_DONE_US
+#define FSBL_POLL_DCFG_DMA_DONE_US	2000000
+#endif
+#ifndef FSBL_POLL_DCFG_PCFG_DONE_US
+#define FSBL_POLL_DCFG_PCFG_DONE_US	1000000
+#endif
+#ifndef FSBL_POLL_NAND_READY_US
+#define FSBL_POLL_NAND_READY_US		10000
+#endif
+#ifndef FSBL_POLL_DMA_DONE_US
+#define FSBL_POLL_DMA_DONE_US		2000000
+#endif
+#ifndef FSBL_POLL_SD_CMD_US
+#define FSBL_POLL_SD_CMD_US			100000
+#endif
+#ifndef FSBL_POLL_SD_READY_US
+#define FSBL_POLL_SD_READY_US		1000000
+#endif
+#ifndef FSBL_POLL_SD_DMA_US
+#define FSBL_POLL_SD_DMA_US			2000000
+#endif
+#ifndef FSBL_POLL_QSPI_WRITE_US
+#define FSBL_POLL_QSPI_WRITE_US		3000000
+#endif
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	XTime Start;
+	XTime Deadline;
+	u32 Site;
+	u32 TimedOut;
+} PollDeadline;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+void PollStart(PollDeadline *Poll, u32 Site);
+u32 PollExpired(PollDeadline *Poll);
+void PollEnd(PollDeadline *Poll);
+u32 PollMask(u32 Site, u32 Address, u32 Mask, u32 Value);
+void PollReport(void);
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___FSBL_POLL_H___ */
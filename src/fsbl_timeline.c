@@ -0,0 +1,182 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_timeline.c
+*
+* Contains the code recording the boot timeline when FSBL_TIMELINE is set.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* Refer to fsbl_timeline.h for the layout of the timeline.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "fsbl_timeline.h"
+
+#ifdef FSBL_TIMELINE
+
+#include "xtime_l.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 TimelineChecksum(void);
+
+/************************** Variable Definitions *****************************/
+static BootTimeline * const Timeline = (BootTimeline *)FSBL_TIMELINE_ADDR;
+
+/******************************************************************************/
+/**
+*
+* This function clears the timeline block and writes its header
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Called first thing in main, before ps7_init
+*
+****************************************************************************/
+void TimelineInit(void)
+{
+	Timeline->Header.Magic = 0;
+	Timeline->Header.Version = TIMELINE_VERSION;
+	Timeline->Header.Count = 0;
+	Timeline->Header.CountsPerSecond = COUNTS_PER_SECOND;
+	Timeline->Header.Checksum = 0;
+}
+
+/******************************************************************************/
+/**
+*
+* This function appends a stage to the timeline with the current global
+* timer value. Entries beyond the capacity of the block are dropped.
+*
+* @param	Stage is one of the TIMELINE_* stage identifiers
+* @param	Index is the partition number for the partition stages
+* @param	Data is the stage specific data word
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void TimelineMark(u32 Stage, u32 Index, u32 Data)
+{
+	TimelineEntry *EntryPtr;
+	XTime Time;
+
+	if (Timeline->Header.Count >= TIMELINE_MAX_ENTRIES) {
+		return;
+	}
+
+	XTime_GetTime(&Time);
+
+	EntryPtr = &Timeline->Entry[Timeline->Header.Count];
+	EntryPtr->Stage = (u16)Stage;
+	EntryPtr->Index = (u16)Index;
+	EntryPtr->Data = Data;
+	EntryPtr->TimeLow = (u32)Time;
+	EntryPtr->TimeHigh = (u32)(Time >> 32);
+
+	Timeline->Header.Count++;
+}
+
+/******************************************************************************/
+/**
+*
+* This function seals the timeline with the magic and checksum so the next
+* stage can trust it.
+*
+* @param	None
+*
+* @return	Address of the timeline block
+*
+* @note		Called just before handoff
+*
+****************************************************************************/
+u32 TimelineFinish(void)
+{
+	Timeline->Header.Magic = TIMELINE_MAGIC;
+	Timeline->Header.Checksum = 0;
+	Timeline->Header.Checksum = TimelineChecksum();
+
+	return (u32)Timeline;
+}
+
+/******************************************************************************/
+/**
+*
+* This function calculates the ones complement of the word sum over the
+* header and the valid entries.
+*
+* @param	None
+*
+* @return	Checksum value
+*
+* @note		None
+*
+****************************************************************************/
+static u32 TimelineChecksum(void)
+{
+	u32 *WordPtr = (u32 *)Timeline;
+	u32 WordCount;
+	u32 Sum = 0;
+	u32 Index;
+
+	WordCount = (sizeof(TimelineHeader) +
+			(Timeline->Header.Count * sizeof(TimelineEntry))) >> 2;
+
+	for (Index = 0; Index < WordCount; Index++) {
+		Sum += WordPtr[Index];
+	}
+
+	return ~Sum;
+}
+
+#endif /* FSBL_TIMELINE */
@@ -0,0 +1,160 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_timeline.h
+*
+* Contains the layout of the boot timeline and the stage identifiers
+* recorded by the FSBL.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* The timeline lives in a block of OCM reserved by the linker script at
+* FSBL_TIMELINE_ADDR. Each entry is a stage identifier, an index (the
+* partition number for the per partition stages), a stage specific data word
+* and the 64 bit global timer value at the end of the stage. The address of
+* the block is handed to the application in R1, it can also be found at the
+* fixed address. Consumers should check the magic, version and checksum
+* before using the entries.
+*
+******************************************************************************/
+#ifndef ___FSBL_TIMELINE_H___
+#define ___FSBL_TIMELINE_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Location and size of the reserved block, must match lscript.ld
+ */
+#define FSBL_TIMELINE_ADDR		0xFFFFFA00
+#define FSBL_TIMELINE_SIZE		0x400
+
+#define TIMELINE_MAGIC			0x4C544246 /**< "FBTL" */
+#define TIMELINE_VERSION		1
+
+#define TIMELINE_MAX_ENTRIES	((FSBL_TIMELINE_SIZE - \
+									sizeof(TimelineHeader)) / \
+									sizeof(TimelineEntry))
+
+/*
+ * Stage identifiers
+ */
+#define TIMELINE_FSBL_ENTRY		0x01 /**< FSBL entered main */
+#define TIMELINE_PS7_INIT		0x02 /**< ps7_init done, Data = 1 if the
+										PLL and DDR init was skipped */
+#define TIMELINE_DDR_CHECK		0x03 /**< DDR check done, Data = 1 if DDR
+										was set up from a training record */
+#define TIMELINE_PCAP_INIT		0x04 /**< Devcfg initialized */
+#define TIMELINE_DEVICE_INIT	0x05 /**< Boot device initialized,
+										Data = boot mode */
+#define TIMELINE_HEADER_LOAD	0x06 /**< Partition headers read,
+										Data = partition count */
+#define TIMELINE_BOOT_DELAY		0x07 /**< Boot delay done,
+										Data = milliseconds waited */
+#define TIMELINE_DDR_TEST		0x08 /**< DDR test done, Index = 1 on
+										failure, Data = KB tested or the
+										failing address */
+#define TIMELINE_PART_START		0x10 /**< Partition processing started,
+										Data = partition attributes */
+#define TIMELINE_PART_MOVE		0x11 /**< Partition copied,
+										Data = bytes */
+#define TIMELINE_PART_VERIFY	0x12 /**< Checksum verified */
+#define TIMELINE_PART_AUTH		0x13 /**< RSA authentication done */
+#define TIMELINE_PART_DECRYPT	0x14 /**< Decryption done */
+#define TIMELINE_PART_PCAP		0x15 /**< Bitstream programmed */
+#define TIMELINE_HANDOFF		0x20 /**< Handoff, Data = handoff address */
+#define TIMELINE_FALLBACK		0x21 /**< Fallback started */
+#define TIMELINE_POLL_WAIT		0x22 /**< Hardware waits, Index = wait site,
+										Data = microseconds waited in total,
+										see fsbl_poll.h */
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u16 Stage;		/**< Stage identifier */
+	u16 Index;		/**< Partition number or 0 */
+	u32 Data;		/**< Stage specific data */
+	u32 TimeLow;	/**< Global timer, lower 32 bits */
+	u32 TimeHigh;	/**< Global timer, upper 32 bits */
+} TimelineEntry;
+
+typedef struct {
+	u32 Magic;			/**< TIMELINE_MAGIC */
+	u16 Version;		/**< TIMELINE_VERSION */
+	u16 Count;			/**< Number of valid entries */
+	u32 CountsPerSecond;/**< Global timer frequency */
+	u32 Checksum;		/**< Ones complement of the word sum, this
+							field taken as zero */
+} TimelineHeader;
+
+typedef struct {
+	TimelineHeader Header;
+	TimelineEntry Entry[1];
+} BootTimeline;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#ifdef FSBL_TIMELINE
+void TimelineInit(void);
+void TimelineMark(u32 Stage, u32 Index, u32 Data);
+u32 TimelineFinish(void);
+#else
+#define TimelineInit()
+#define TimelineMark(Stage, Index, Data)
+#define TimelineFinish()	(0)
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___FSBL_TIMELINE_H___ */
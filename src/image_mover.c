@@ -73,6 +73,15 @@
 * 						fallback image offset handling using MD5
 * 						Fix for PR#782309 Fallback support for AES
 * 						encryption with E-Fuse - Enhancement
+* 12.00a hx 10/18/26	Added the boot timeline stages
+*						Keep the data cache on during the load with
+*						FSBL_CACHED_LOAD
+*						Boot header words and partition checksums
+*						read with MoveImageV
+*						Asynchronous moves, the next partition is read
+*						while the current one is verified
+*						Headers parsed from one read into the header
+*						arena
 *
 * </pre>
 *
@@ -89,6 +98,10 @@
 #include "pcap.h"
 #include "fsbl_hooks.h"
 #include "md5.h"
+#include "fsbl_timeline.h"
+#include "fsbl_cache.h"
+#include "fsbl_pmu.h"
+#include <string.h>
 
 #include "dbg_print.h"
 
@@ -113,6 +126,16 @@
 /************************** Function Prototypes ******************************/
 u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset);
 u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum);
+static void PartitionChecksumPrefetch(u32 ImageBaseAddress);
+static void HeaderArenaLoad(u32 ImageBaseAddress);
+static u32 HeaderRead(u32 SourceAddress, u32 DestinationAddress,
+		u32 LengthBytes);
+static void PartitionPrefetch(u32 ImageBaseAddress, u32 PartitionNum,
+		u32 BusyAddr, u32 BusyLength);
+static void PartitionPrefetchPoll(void);
+static u32 PartitionPrefetchWait(void);
+static u32 PartitionFetch(u32 SourceAddr, u32 LoadAddr, u32 LengthBytes);
+static void MoveImageAdvance(void);
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum);
 u32 DumpFirstBootSectionHeader( u32 ImageStartAddress );
 
@@ -131,6 +154,44 @@ u8 ApplicationFlag;
 
 u32 ExecutionAddress;
 ImageMoverType MoveImage;
+ImageMoverVType MoveImageV;
+ImageMoverStepType MoveImageStep;
+
+/*
+ * Submitted moves, they are run by the device in submission order
+ */
+static MoveRequest MoveQueue[MOVE_ASYNC_SLOTS];
+static u32 MoveSequence;
+
+/*
+ * Read of the next partition started by PartitionPrefetch
+ */
+static u32 PrefetchHandle = MOVE_HANDLE_NONE;
+static u32 PrefetchSource;
+static u32 PrefetchDestination;
+static u32 PrefetchLength;
+static u32 PrefetchStatus;
+
+/*
+ * Bounce buffer of MoveImageVector
+ */
+static u32 MoveBounce[MOVE_V_BOUNCE_SIZE / 4] __attribute__ ((aligned(32)));
+
+/*
+ * Start of the image read by HeaderArenaLoad, the header accessors take
+ * their data from here. HeaderArenaLength is 0 when it holds nothing
+ */
+static u32 HeaderArena[HEADER_ARENA_SIZE / 4] __attribute__ ((aligned(32)));
+static u32 HeaderArenaBase;
+static u32 HeaderArenaLength;
+
+/*
+ * Partition checksums fetched by PartitionChecksumPrefetch and their
+ * flash addresses
+ */
+static u8 ChecksumCache[MAX_PARTITION_NUMBER][MD5_CHECKSUM_SIZE];
+static u32 ChecksumCacheSource[MAX_PARTITION_NUMBER];
+static u32 ChecksumCacheCount;
 
 /*
  * Header array
@@ -189,6 +250,11 @@ u32 LoadBootImage(void)
 	BitstreamFlag = 0;
 	ApplicationFlag = 0;
 
+	/*
+	 * Partitions are moved, hashed and decrypted with the cache on
+	 */
+	CacheLoadEnable();
+
 	RebootStatusRegister = Xil_In32(REBOOT_STATUS_REG);
 	fsbl_printf(DEBUG_INFO,
 			"Reboot status register: 0x%08x\r\n",RebootStatusRegister);
@@ -246,6 +312,7 @@ u32 LoadBootImage(void)
 		OutputStatus(GET_HEADER_INFO_FAIL);
 		FsblFallback();
 	}
+	TimelineMark(TIMELINE_HEADER_LOAD, 0, PartitionCount);
 
 	/*
 	 * RSA is not implemented in 1.0 and 2.0
@@ -461,6 +528,7 @@ u32 LoadBootImage(void)
 		/*
 		 * Move partitions from boot device
 		 */
+		TimelineMark(TIMELINE_PART_START, PartitionNum, PartitionAttr);
 		Status = PartitionMove(ImageStartAddress, HeaderPtr);
 		if (Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL,"PARTITION_MOVE_FAIL\r\n");
@@ -468,6 +536,16 @@ u32 LoadBootImage(void)
 			FsblFallback();
 		}
 
+		/*
+		 * Start reading the next partition while this one is verified,
+		 * decrypted and loaded into the PL
+		 */
+		PartitionPrefetch(ImageStartAddress, PartitionNum + 1,
+				PLPartitionFlag ? DDR_TEMP_START_ADDR : PartitionLoadAddr,
+				((PartitionTotalSize > PartitionImageLength) ?
+					PartitionTotalSize : PartitionImageLength) <<
+						WORD_LENGTH_SHIFT);
+
 		if ((SignedPartitionFlag) || (PartitionChecksumFlag)) {
 			if(PLPartitionFlag) {
 				/*
@@ -492,6 +570,7 @@ u32 LoadBootImage(void)
 					OutputStatus(PARTITION_CHECKSUM_FAIL);
 					FsblFallback();
 				}
+				TimelineMark(TIMELINE_PART_VERIFY, PartitionNum, 0);
 
 				fsbl_printf(DEBUG_INFO, "Partition Validation Done\r\n");
 			}
@@ -501,19 +580,26 @@ u32 LoadBootImage(void)
 			 */
 			if (SignedPartitionFlag == 1 ) {
 #ifdef RSA_SUPPORT
+#ifndef FSBL_CACHED_LOAD
 				Xil_DCacheEnable();
+#endif
 				Status = AuthenticatePartition((u8*)PartitionStartAddr,
 						(PartitionTotalSize << WORD_LENGTH_SHIFT));
 				if (Status != XST_SUCCESS) {
+#ifndef FSBL_CACHED_LOAD
 					Xil_DCacheFlush();
 		        	Xil_DCacheDisable();
+#endif
 					fsbl_printf(DEBUG_GENERAL,"AUTHENTICATION_FAIL\r\n");
 					OutputStatus(AUTHENTICATION_FAIL);
 					FsblFallback();
 				}
+				TimelineMark(TIMELINE_PART_AUTH, PartitionNum, 0);
 				fsbl_printf(DEBUG_INFO,"Authentication Done\r\n");
+#ifndef FSBL_CACHED_LOAD
 				Xil_DCacheFlush();
                 Xil_DCacheDisable();
+#endif
 #else
 				/*
 				 * In case user not enabled RSA authentication feature
@@ -536,6 +622,7 @@ u32 LoadBootImage(void)
 					OutputStatus(DECRYPTION_FAIL);
 					FsblFallback();
 				}
+				TimelineMark(TIMELINE_PART_DECRYPT, PartitionNum, 0);
 			}
 
 			/*
@@ -552,6 +639,7 @@ u32 LoadBootImage(void)
 					OutputStatus(BITSTREAM_DOWNLOAD_FAIL);
 					FsblFallback();
 				}
+				TimelineMark(TIMELINE_PART_PCAP, PartitionNum, 0);
 			}
 		}
 
@@ -573,6 +661,13 @@ u32 LoadBootImage(void)
 		PartitionNum++;
 	}
 
+	/*
+	 * A partition read ahead but not loaded must not run into the handoff
+	 */
+	(void)PartitionPrefetchWait();
+
+	CacheLoadDisable();
+
 	return ExecAddress;
 }
 
@@ -586,7 +681,8 @@ u32 LoadBootImage(void)
 * @return	- XST_SUCCESS if Get partition Header information successful
 *			- XST_FAILURE if Get Partition Header information failed
 *
-* @note		None
+* @note		The headers are read from the device once, into the header
+*		arena. The partition checksums are read with one MoveImageV.
 *
 ****************************************************************************/
 u32 GetPartitionHeaderInfo(u32 ImageBaseAddress)
@@ -594,6 +690,7 @@ u32 GetPartitionHeaderInfo(u32 ImageBaseAddress)
     u32 PartitionHeaderOffset;
     u32 Status;
 
+    HeaderArenaLoad(ImageBaseAddress);
 
     /*
      * Get the length of the FSBL from BootHeader
@@ -652,9 +749,114 @@ u32 GetPartitionHeaderInfo(u32 ImageBaseAddress)
 #endif
 	}
 
+	PartitionChecksumPrefetch(ImageBaseAddress);
+
     return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function reads the MD5 checksums of all the partitions that have one
+* with a single MoveImageV, GetPartitionChecksum then takes them from here
+*
+* @param	ImageBaseAddress is the start address of the image
+*
+* @return	None
+*
+* @note		If the read fails the checksums are read one by one later, so
+*		the failure is reported where it was before.
+*
+****************************************************************************/
+static void PartitionChecksumPrefetch(u32 ImageBaseAddress)
+{
+	MoveSegment Segments[MAX_PARTITION_NUMBER];
+	u32 Index;
+	u32 Count = 0;
+
+	ChecksumCacheCount = 0;
+
+	for (Index = 0; Index < PartitionCount; Index++) {
+		if (((PartitionHeader[Index].PartitionAttr &
+				ATTRIBUTE_CHECKSUM_TYPE_MASK) == 0) ||
+				(PartitionHeader[Index].CheckSumOffset == 0)) {
+			continue;
+		}
+		ChecksumCacheSource[Count] = ImageBaseAddress +
+			(PartitionHeader[Index].CheckSumOffset << WORD_LENGTH_SHIFT);
+		Segments[Count].SourceAddress = ChecksumCacheSource[Count];
+		Segments[Count].DestinationAddress = (u32)ChecksumCache[Count];
+		Segments[Count].LengthBytes = MD5_CHECKSUM_SIZE;
+		Count++;
+	}
+
+	if ((Count != 0) && (MoveImageV(Segments, Count) == XST_SUCCESS)) {
+		ChecksumCacheCount = Count;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the start of the image into the header arena with a
+* single device read. It holds the boot header, the image header table, the
+* image and partition headers and the header signature of a bootgen image.
+*
+* @param	ImageBaseAddress is the start address of the image
+*
+* @return	None
+*
+* @note		If the read fails the arena is left empty and the accessors
+*		read the device as before, so the failure is reported there.
+*
+****************************************************************************/
+static void HeaderArenaLoad(u32 ImageBaseAddress)
+{
+	HeaderArenaLength = 0;
+
+	if (MoveImage(ImageBaseAddress, (u32)HeaderArena,
+			HEADER_ARENA_SIZE) != XST_SUCCESS) {
+		fsbl_printf(DEBUG_INFO, "Header arena not loaded\r\n");
+		return;
+	}
+
+	HeaderArenaBase = ImageBaseAddress;
+	HeaderArenaLength = HEADER_ARENA_SIZE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads header data, from the header arena when it holds
+* all of it and from the device otherwise
+*
+* @param	SourceAddress is the address on the device
+* @param	DestinationAddress is the destination
+* @param	LengthBytes is the number of bytes to read
+*
+* @return
+*		- XST_SUCCESS if the data is at the destination
+*		- XST_FAILURE if the device read failed
+*
+* @note		None
+*
+****************************************************************************/
+static u32 HeaderRead(u32 SourceAddress, u32 DestinationAddress,
+		u32 LengthBytes)
+{
+	if ((HeaderArenaLength != 0) && (SourceAddress >= HeaderArenaBase) &&
+			((SourceAddress - HeaderArenaBase) <= HeaderArenaLength) &&
+			(LengthBytes <= (HeaderArenaLength -
+					(SourceAddress - HeaderArenaBase)))) {
+		memcpy((void *)DestinationAddress,
+				(u8 *)HeaderArena + (SourceAddress - HeaderArenaBase),
+				LengthBytes);
+		return XST_SUCCESS;
+	}
+
+	return MoveImage(SourceAddress, DestinationAddress, LengthBytes);
+}
+
 
 /*****************************************************************************/
 /**
@@ -675,7 +877,7 @@ u32 GetPartitionHeaderStartAddr(u32 ImageAddress, u32 *Offset)
 {
 	u32 Status;
 
-	Status = MoveImage(ImageAddress + IMAGE_PHDR_OFFSET, (u32)Offset, 4);
+	Status = HeaderRead(ImageAddress + IMAGE_PHDR_OFFSET, (u32)Offset, 4);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_GENERAL,"Move Image failed\r\n");
 		return XST_FAILURE;
@@ -703,7 +905,7 @@ u32 GetImageHeaderStartAddr(u32 ImageAddress, u32 *Offset)
 {
 	u32 Status;
 
-	Status = MoveImage(ImageAddress + IMAGE_HDR_OFFSET, (u32)Offset, 4);
+	Status = HeaderRead(ImageAddress + IMAGE_HDR_OFFSET, (u32)Offset, 4);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_GENERAL,"Move Image failed\r\n");
 		return XST_FAILURE;
@@ -760,7 +962,7 @@ u32 GetFsblLength(u32 ImageAddress, u32 *FsblLength)
 {
 	u32 Status;
 
-	Status = MoveImage(ImageAddress + IMAGE_TOT_BYTE_LEN_OFFSET,
+	Status = HeaderRead(ImageAddress + IMAGE_TOT_BYTE_LEN_OFFSET,
 							(u32)FsblLength, 4);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_GENERAL,"Move Image failed reading FsblLength\r\n");
@@ -794,7 +996,7 @@ u32 GetImageHeaderAndSignature(u32 ImageBaseAddress, u32 *Offset)
 	u32 ImageHeaderOffset;
 
 	/*
-	 * Get the start address of the partition header table
+	 * Get the start address of the image header table
 	 */
 	Status = GetImageHeaderStartAddr(ImageBaseAddress, &ImageHeaderOffset);
 	if (Status != XST_SUCCESS) {
@@ -802,7 +1004,7 @@ u32 GetImageHeaderAndSignature(u32 ImageBaseAddress, u32 *Offset)
 		return XST_FAILURE;
 	}
 
-	Status = MoveImage(ImageBaseAddress+ImageHeaderOffset, (u32)Offset,
+	Status = HeaderRead(ImageBaseAddress+ImageHeaderOffset, (u32)Offset,
 							TOTAL_HEADER_SIZE + RSA_SIGNATURE_SIZE);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_GENERAL,"Move Image failed\r\n");
@@ -832,7 +1034,7 @@ u32 LoadPartitionsHeaderInfo(u32 PartHeaderOffset,  PartHeader *Header)
 {
 	u32 Status;
 
-	Status = MoveImage(PartHeaderOffset, (u32)Header, sizeof(PartHeader)*MAX_PARTITION_NUMBER);
+	Status = HeaderRead(PartHeaderOffset, (u32)Header, sizeof(PartHeader)*MAX_PARTITION_NUMBER);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_GENERAL,"Move Image failed\r\n");
 		return XST_FAILURE;
@@ -1092,6 +1294,9 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
     u32 LoadAddr;
     u32 ImageWordLen;
     u32 DataWordLen;
+#ifdef FSBL_TIMELINE
+    u32 PartitionNum = (u32)(Header - PartitionHeader);
+#endif
 
 	SourceAddr = ImageBaseAddress;
 	SourceAddr += Header->PartitionStart<<WORD_LENGTH_SHIFT;
@@ -1144,13 +1349,15 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 			LoadAddr = DDR_TEMP_START_ADDR;
 		}
 
-		Status = MoveImage(SourceAddr,
+		Status = PartitionFetch(SourceAddr,
 						LoadAddr,
 						(ImageWordLen << WORD_LENGTH_SHIFT));
 		if(Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL, "Move Image Failed\r\n");
 			return XST_FAILURE;
 		}
+		TimelineMark(TIMELINE_PART_MOVE, PartitionNum,
+				ImageWordLen << WORD_LENGTH_SHIFT);
 
 		/*
 		 * As image present at load address
@@ -1183,6 +1390,9 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 			fsbl_printf(DEBUG_GENERAL, "PCAP Data Transfer Failed\r\n");
 			return XST_FAILURE;
 		}
+		TimelineMark(SecureTransferFlag ? TIMELINE_PART_DECRYPT :
+				TIMELINE_PART_MOVE, PartitionNum,
+				ImageWordLen << WORD_LENGTH_SHIFT);
 
 		/*
 		 * As image present at load address
@@ -1204,12 +1414,178 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 			fsbl_printf(DEBUG_GENERAL, "PCAP Bitstream Download Failed\r\n");
 			return XST_FAILURE;
 		}
+		TimelineMark(TIMELINE_PART_PCAP, PartitionNum, 0);
 	}
 
 	return XST_SUCCESS;
 }
 
 
+/******************************************************************************/
+/**
+*
+* This function starts reading a partition from a non linear boot device
+* into the place PartitionMove would move it to. It is not started when it
+* would land on the memory still used by the current partition, or when the
+* partition is not loaded by FSBL.
+*
+* @param	ImageBaseAddress is the start address of the image
+* @param	PartitionNum is the partition to read
+* @param	BusyAddr is the start of the memory used by the current partition
+* @param	BusyLength is its length in bytes
+*
+* @return	None
+*
+* @note		PartitionMove picks the data up if the partition is loaded
+*		with the same source, destination and length.
+*
+*******************************************************************************/
+static void PartitionPrefetch(u32 ImageBaseAddress, u32 PartitionNum,
+		u32 BusyAddr, u32 BusyLength)
+{
+	PartHeader *Header;
+	u32 PartitionAttr;
+	u32 SourceAddr;
+	u32 LoadAddr;
+	u32 Length;
+
+	if (LinearBootDeviceFlag || (PartitionNum >= PartitionCount) ||
+			(PrefetchHandle != MOVE_HANDLE_NONE)) {
+		return;
+	}
+
+	Header = &PartitionHeader[PartitionNum];
+	PartitionAttr = Header->PartitionAttr;
+	if (((PartitionAttr & ATTRIBUTE_PARTITION_OWNER_MASK) !=
+			ATTRIBUTE_PARTITION_OWNER_FSBL) ||
+			(ValidateHeader(Header) != XST_SUCCESS)) {
+		return;
+	}
+
+	if (PartitionAttr & ATTRIBUTE_PL_IMAGE_MASK) {
+		/*
+		 * A bitstream after an application is not loaded
+		 */
+		if (ApplicationFlag) {
+			return;
+		}
+		LoadAddr = DDR_TEMP_START_ADDR;
+	} else if (PartitionAttr & ATTRIBUTE_PS_IMAGE_MASK) {
+		LoadAddr = Header->LoadAddr;
+		if ((LoadAddr < DDR_START_ADDR) || (LoadAddr > DDR_END_ADDR)) {
+			return;
+		}
+	} else {
+		return;
+	}
+
+	if (PartitionAttr &
+			(ATTRIBUTE_CHECKSUM_TYPE_MASK | ATTRIBUTE_RSA_PRESENT_MASK)) {
+		Length = Header->PartitionWordLen << WORD_LENGTH_SHIFT;
+	} else {
+		Length = Header->ImageWordLen << WORD_LENGTH_SHIFT;
+	}
+
+	if ((Length == 0) || ((LoadAddr < (BusyAddr + BusyLength)) &&
+			(BusyAddr < (LoadAddr + Length)))) {
+		return;
+	}
+
+	SourceAddr = ImageBaseAddress +
+			(Header->PartitionStart << WORD_LENGTH_SHIFT);
+
+	PrefetchHandle = MoveImageSubmit(SourceAddr, LoadAddr, Length);
+	if (PrefetchHandle != MOVE_HANDLE_NONE) {
+		PrefetchSource = SourceAddr;
+		PrefetchDestination = LoadAddr;
+		PrefetchLength = Length;
+		fsbl_printf(DEBUG_INFO, "Partition %d read ahead\r\n",
+				PartitionNum);
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function lets the read started by PartitionPrefetch go on
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Called between the chunks of the partition hash.
+*
+*******************************************************************************/
+static void PartitionPrefetchPoll(void)
+{
+	if (PrefetchHandle != MOVE_HANDLE_NONE) {
+		(void)MoveImagePoll(PrefetchHandle);
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for the read started by PartitionPrefetch
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the read completed or none was running
+*		- XST_FAILURE if it failed
+*
+* @note		The result is kept for PartitionFetch.
+*
+*******************************************************************************/
+static u32 PartitionPrefetchWait(void)
+{
+	if (PrefetchHandle == MOVE_HANDLE_NONE) {
+		return XST_SUCCESS;
+	}
+
+	PrefetchStatus = MoveImageWait(PrefetchHandle);
+	PrefetchHandle = MOVE_HANDLE_NONE;
+
+	return PrefetchStatus;
+}
+
+/******************************************************************************/
+/**
+*
+* This function moves a partition from a non linear boot device, taking
+* the data read ahead by PartitionPrefetch when it matches
+*
+* @param	SourceAddr is the partition start on the device
+* @param	LoadAddr is the destination
+* @param	LengthBytes is the number of bytes to move
+*
+* @return
+*		- XST_SUCCESS if the partition is at the destination
+*		- XST_FAILURE if the move failed
+*
+* @note		A failed read ahead is done again with MoveImage.
+*
+*******************************************************************************/
+static u32 PartitionFetch(u32 SourceAddr, u32 LoadAddr, u32 LengthBytes)
+{
+	u32 Hit;
+
+	(void)PartitionPrefetchWait();
+
+	Hit = (PrefetchLength != 0) && (PrefetchStatus == XST_SUCCESS) &&
+			(PrefetchSource == SourceAddr) &&
+			(PrefetchDestination == LoadAddr) &&
+			(PrefetchLength == LengthBytes);
+	PrefetchLength = 0;
+
+	if (Hit) {
+		return XST_SUCCESS;
+	}
+
+	return MoveImage(SourceAddr, LoadAddr, LengthBytes);
+}
+
+
 /******************************************************************************/
 /**
 *
@@ -1334,12 +1710,27 @@ u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset)
 *		- XST_SUCCESS if checksum read success
 *		- XST_FAILURE if unable get checksum
 *
-* @note		None
+* @note		Checksums fetched by PartitionChecksumPrefetch are not read
+*		again. A running read of the next partition is completed before
+*		the flash is read.
 *
 *******************************************************************************/
 u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum)
 {
     u32 Status;
+    u32 Index;
+
+    for (Index = 0; Index < ChecksumCacheCount; Index++) {
+        if (ChecksumCacheSource[Index] == ChecksumOffset) {
+            memcpy(Checksum, ChecksumCache[Index], MD5_CHECKSUM_SIZE);
+            return XST_SUCCESS;
+        }
+    }
+
+    /*
+     * The device is read in order, let the next partition finish first
+     */
+    (void)PartitionPrefetchWait();
 
     Status = MoveImage(ChecksumOffset, (u32)Checksum, MD5_CHECKSUM_SIZE);
     if(Status != XST_SUCCESS) {
@@ -1368,11 +1759,302 @@ u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum)
 *******************************************************************************/
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum)
 {
+	MD5Context Context;
+	u32 Length;
+
+	PMU_SCOPE_BEGIN(PMU_SCOPE_MD5);
+
 	/*
-	 * Calculate checksum using MD5 algorithm
+	 * Calculate checksum using MD5 algorithm, a chunk at a time so that
+	 * the read of the next partition keeps going
 	 */
-	md5((u8*)SourceAddr, DataLength, Checksum, 0 );
+	MD5Init(&Context);
+	while (DataLength != 0) {
+		Length = (DataLength > MOVE_ASYNC_CHUNK) ?
+				MOVE_ASYNC_CHUNK : DataLength;
+		MD5Update(&Context, (u8*)SourceAddr, Length, 0);
+		SourceAddr += Length;
+		DataLength -= Length;
+
+		PartitionPrefetchPoll();
+	}
+	MD5Final(&Context, Checksum, 0);
+
+	PMU_SCOPE_END(PMU_SCOPE_MD5);
 
     return XST_SUCCESS;
 }
 
+
+/******************************************************************************/
+/**
+*
+* This function moves a list of segments with as few calls of the device
+* mover as possible. The segments are sorted on the device address and
+* the ones closer than MergeGap to each other are read together. A merged
+* read lands directly when the segments also follow each other in memory,
+* otherwise it goes through the bounce buffer and is copied out.
+*
+* @param	Segments is the list of segments, it is sorted in place
+* @param	Count is the number of segments
+* @param	Mover is the device mover
+* @param	MergeGap is the largest gap in bytes read to merge two segments
+*
+* @return
+*		- XST_SUCCESS if all the segments were moved
+*		- XST_FAILURE if a device read failed
+*
+* @note		Used by the per device MoveImageV implementations.
+*
+*******************************************************************************/
+u32 MoveImageVector(MoveSegment *Segments, u32 Count, ImageMoverType Mover,
+		u32 MergeGap)
+{
+	MoveSegment Segment;
+	u32 Index;
+	u32 First;
+	u32 Next;
+	u32 Last;
+	u32 Start;
+	u32 End;
+	u32 SegmentEnd;
+	u32 Direct;
+	u32 Status;
+
+	/*
+	 * Insertion sort on the device address, the lists are short
+	 */
+	for (Index = 1; Index < Count; Index++) {
+		Segment = Segments[Index];
+		Next = Index;
+		while ((Next > 0) &&
+				(Segments[Next - 1].SourceAddress > Segment.SourceAddress)) {
+			Segments[Next] = Segments[Next - 1];
+			Next--;
+		}
+		Segments[Next] = Segment;
+	}
+
+	First = 0;
+	while (First < Count) {
+		if (Segments[First].LengthBytes == 0) {
+			First++;
+			continue;
+		}
+
+		Start = Segments[First].SourceAddress;
+		End = Start + Segments[First].LengthBytes;
+		Last = First;
+		Direct = 1;
+
+		/*
+		 * Take in the next segments while they start within MergeGap of
+		 * the end. The read stays direct while the segments follow each
+		 * other on both sides, otherwise it has to fit the bounce buffer
+		 */
+		for (Next = First + 1; Next < Count; Next++) {
+			if (Segments[Next].LengthBytes == 0) {
+				continue;
+			}
+			if ((Segments[Next].SourceAddress - Start) >
+					((End - Start) + MergeGap)) {
+				break;
+			}
+
+			SegmentEnd = Segments[Next].SourceAddress +
+					Segments[Next].LengthBytes;
+			if (Direct && (Segments[Next].SourceAddress == End) &&
+					(Segments[Next].DestinationAddress ==
+					(Segments[Last].DestinationAddress +
+						Segments[Last].LengthBytes))) {
+				End = SegmentEnd;
+				Last = Next;
+				continue;
+			}
+
+			if (SegmentEnd < End) {
+				SegmentEnd = End;
+			}
+			if ((SegmentEnd - Start) > MOVE_V_BOUNCE_SIZE) {
+				break;
+			}
+			End = SegmentEnd;
+			Last = Next;
+			Direct = 0;
+		}
+
+		if (Direct) {
+			Status = Mover(Start, Segments[First].DestinationAddress,
+					End - Start);
+		} else {
+			Status = Mover(Start, (u32)MoveBounce, End - Start);
+			for (Index = First; (Index < Next) && (Status == XST_SUCCESS);
+					Index++) {
+				memcpy((void *)Segments[Index].DestinationAddress,
+					(u8 *)MoveBounce +
+						(Segments[Index].SourceAddress - Start),
+					Segments[Index].LengthBytes);
+			}
+		}
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		First = Next;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function queues a move from the boot device. The device runs the
+* queued moves in order, with DMA where its MoveImageStep supports it. For
+* devices without one the move is done with MoveImage before this function
+* returns.
+*
+* @param	SourceAddress is the address on the device
+* @param	DestinationAddress is the destination
+* @param	LengthBytes is the number of bytes to move
+*
+* @return	The handle of the move, MOVE_HANDLE_NONE if all the slots are
+*		used
+*
+* @note		Every move is ended with MoveImageWait. MoveImage must not be
+*		used while a move is queued.
+*
+*******************************************************************************/
+u32 MoveImageSubmit(u32 SourceAddress, u32 DestinationAddress,
+		u32 LengthBytes)
+{
+	MoveRequest *Request;
+	u32 Handle;
+
+	for (Handle = 0; Handle < MOVE_ASYNC_SLOTS; Handle++) {
+		if (MoveQueue[Handle].Sequence == 0) {
+			break;
+		}
+	}
+	if (Handle == MOVE_ASYNC_SLOTS) {
+		return MOVE_HANDLE_NONE;
+	}
+
+	Request = &MoveQueue[Handle];
+	Request->SourceAddress = SourceAddress;
+	Request->DestinationAddress = DestinationAddress;
+	Request->LengthBytes = LengthBytes;
+	Request->Moved = 0;
+	Request->Status = (LengthBytes != 0) ? XST_DEVICE_BUSY : XST_SUCCESS;
+	Request->Sequence = ++MoveSequence;
+
+	/*
+	 * Start the device on it if it is idle
+	 */
+	MoveImageAdvance();
+
+	return Handle;
+}
+
+/******************************************************************************/
+/**
+*
+* This function checks a queued move and lets the device go on with the
+* queue
+*
+* @param	Handle is the handle returned by MoveImageSubmit
+*
+* @return
+*		- XST_DEVICE_BUSY while the move is running
+*		- XST_SUCCESS once the data is at the destination
+*		- XST_FAILURE if the move failed or the handle is not valid
+*
+* @note		None
+*
+*******************************************************************************/
+u32 MoveImagePoll(u32 Handle)
+{
+	if ((Handle >= MOVE_ASYNC_SLOTS) || (MoveQueue[Handle].Sequence == 0)) {
+		return XST_FAILURE;
+	}
+
+	if (MoveQueue[Handle].Status == XST_DEVICE_BUSY) {
+		MoveImageAdvance();
+	}
+
+	return MoveQueue[Handle].Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for a queued move and frees its slot
+*
+* @param	Handle is the handle returned by MoveImageSubmit
+*
+* @return
+*		- XST_SUCCESS if the data is at the destination
+*		- XST_FAILURE if the move failed or the handle is not valid
+*
+* @note		The moves queued before it are completed first.
+*
+*******************************************************************************/
+u32 MoveImageWait(u32 Handle)
+{
+	u32 Status;
+
+	do {
+		Status = MoveImagePoll(Handle);
+	} while (Status == XST_DEVICE_BUSY);
+
+	if (Handle < MOVE_ASYNC_SLOTS) {
+		MoveQueue[Handle].Sequence = 0;
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function advances the oldest running move. When it completes, the
+* next one is started so the device does not sit idle between them.
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Without a MoveImageStep for the device the move is done with
+*		MoveImage.
+*
+*******************************************************************************/
+static void MoveImageAdvance(void)
+{
+	MoveRequest *Request;
+	u32 Index;
+
+	do {
+		Request = NULL;
+		for (Index = 0; Index < MOVE_ASYNC_SLOTS; Index++) {
+			if ((MoveQueue[Index].Sequence != 0) &&
+					(MoveQueue[Index].Status == XST_DEVICE_BUSY) &&
+					((Request == NULL) ||
+					(MoveQueue[Index].Sequence < Request->Sequence))) {
+				Request = &MoveQueue[Index];
+			}
+		}
+		if (Request == NULL) {
+			return;
+		}
+
+		if (MoveImageStep != NULL) {
+			Request->Status = MoveImageStep(Request);
+		} else {
+			Request->Status = MoveImage(Request->SourceAddress,
+					Request->DestinationAddress, Request->LengthBytes);
+			if (Request->Status == XST_SUCCESS) {
+				Request->Moved = Request->LengthBytes;
+			}
+		}
+	} while (Request->Status != XST_DEVICE_BUSY);
+}
@@ -46,6 +46,10 @@
 * 2.00a jz	06/04/11	partition header expands to 12 words
 * 5.00a kc	07/30/13	Added defines for image header information
 * 8.00a kc	01/16/13	Added defines for partition owner attribute
+* 12.00a hx	10/18/26	Added the vectored mover MoveImageV
+*						Added the asynchronous moves MoveImageSubmit,
+*						MoveImagePoll and MoveImageWait
+*						Added HEADER_ARENA_SIZE
 * </pre>
 *
 * @note
@@ -100,12 +104,72 @@ extern "C" {
 
 #define ATTRIBUTE_PARTITION_OWNER_FSBL	0x00000	/* FSBL Partition Owner */
 
+/*
+ * Segments of a vectored move that are close on the device but do not land
+ * next to each other are read into a bounce buffer of this size with one
+ * device transaction
+ */
+#ifndef MOVE_V_BOUNCE_SIZE
+#define MOVE_V_BOUNCE_SIZE			4096
+#endif
+
+/*
+ * Start of the image read at once by GetPartitionHeaderInfo. It has to hold
+ * the boot header, the image header table, the image and partition headers
+ * and the header signature
+ */
+#ifndef HEADER_ARENA_SIZE
+#define HEADER_ARENA_SIZE			0x2000
+#endif
+
+/*
+ * Asynchronous moves that can be outstanding at the same time
+ */
+#ifndef MOVE_ASYNC_SLOTS
+#define MOVE_ASYNC_SLOTS			2
+#endif
+
+/*
+ * Data hashed between two polls of a running move
+ */
+#ifndef MOVE_ASYNC_CHUNK
+#define MOVE_ASYNC_CHUNK			0x10000
+#endif
+
+/*
+ * Returned by MoveImageSubmit when the move could not be queued
+ */
+#define MOVE_HANDLE_NONE			0xFFFFFFFF
+
 
 /**************************** Type Definitions *******************************/
 typedef u32 (*ImageMoverType)( u32 SourceAddress,
 				u32 DestinationAddress,
 				u32 LengthBytes);
 
+typedef struct {
+	u32 SourceAddress;
+	u32 DestinationAddress;
+	u32 LengthBytes;
+} MoveSegment;
+
+typedef u32 (*ImageMoverVType)(MoveSegment *Segments, u32 Count);
+
+typedef struct {
+	u32 SourceAddress;
+	u32 DestinationAddress;
+	u32 LengthBytes;
+	u32 Moved;		/* Bytes in the destination */
+	u32 Status;		/* XST_DEVICE_BUSY while running */
+	u32 Sequence;	/* Submission order, 0 for a free slot */
+} MoveRequest;
+
+/*
+ * Advances a move, returns XST_DEVICE_BUSY while the device still works on
+ * it, XST_SUCCESS once it is complete and XST_FAILURE on an error
+ */
+typedef u32 (*ImageMoverStepType)(MoveRequest *Request);
+
 typedef struct StructPartHeader {
 	u32 ImageWordLen;	/* 0x0 */
 	u32 DataWordLen;	/* 0x4 */
@@ -146,6 +210,12 @@ void HeaderDump(PartHeader *Header);
 u32 GetPartitionCount(PartHeader *Header);
 u32 ValidateHeader(PartHeader *Header);
 u32 DecryptPartition(u32 StartAddr, u32 DataLength, u32 ImageLength);
+u32 MoveImageVector(MoveSegment *Segments, u32 Count, ImageMoverType Mover,
+		u32 MergeGap);
+u32 MoveImageSubmit(u32 SourceAddress, u32 DestinationAddress,
+		u32 LengthBytes);
+u32 MoveImagePoll(u32 Handle);
+u32 MoveImageWait(u32 Handle);
 
 /************************** Variable Definitions *****************************/
 
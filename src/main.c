@@ -99,6 +99,23 @@
 * 11.00a kv 10/08/14	Fix for CR#826030 - LinearBootDeviceFlag should
 *											be initialized to 0 in IO mode
 *											case
+* 12.00a hx 10/18/26	Added buffered, interrupt driven console output
+*						Added the boot timeline
+*						Added PMU scope profiling
+*						Added the cache enabled load mode
+*						Replaced the 90 second wait before handoff by
+*						the boot delay policy
+*						Report the ps7_init warm reset fast path
+*						Verify or record the cached DDR training
+*						Store a fresh DDR training in the QSPI flash
+*						Report the hardware wait times
+*						DDRInitCheck runs the time bounded DDR test
+*						NAND timing is raised by InitNand
+*						NAND image search steps by erase block
+*						DMAC copy service, memcpy_rom uses it
+*						Boot header checksum read with MoveImageV
+*						SD moves can run asynchronously
+*						Image directory lookup with FSBL_IMAGE_DIRECTORY
 * </pre>
 *
 * @note
@@ -129,6 +146,15 @@
 #include "xil_exception.h"
 #include "xstatus.h"
 #include "fsbl_hooks.h"
+#include "fsbl_console.h"
+#include "fsbl_timeline.h"
+#include "fsbl_pmu.h"
+#include "fsbl_cache.h"
+#include "fsbl_bootdelay.h"
+#include "fsbl_poll.h"
+#include "fsbl_ddrtest.h"
+#include "fsbl_dma.h"
+#include "ps7_init_gen.h"
 #include "xtime_l.h"
 
 #ifdef XPAR_XWDTPS_0_BASEADDR
@@ -156,11 +182,22 @@
 #define WDT_CRV_SHIFT		12
 #endif
 
-#define FSBL_WAIT_UBOOT_SECOND		90
 #define FSBL_QSPI_WAIT_MILI_SECOND	20
 
 
 /**************************** Type Definitions *******************************/
+#ifdef FSBL_IMAGE_DIRECTORY
+/*
+ * Image directory at IMAGE_DIRECTORY_OFFSET. Checksum is the complement of
+ * the sum of the other words
+ */
+typedef struct {
+	u32 Magic;
+	u32 Count;
+	u32 Offset[IMAGE_DIRECTORY_ENTRIES];
+	u32 Checksum;
+} ImageDirectory;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -192,6 +229,9 @@ void  CheckWDTReset(void);
 #endif
 
 u32 NextValidImageCheck(void);
+#ifdef FSBL_IMAGE_DIRECTORY
+static u32 ImageDirectoryFind(u32 StartAddr, u32 EndAddr, u32 *ImageAddr);
+#endif
 
 u32 DDRInitCheck(void);
 
@@ -219,6 +259,8 @@ u32 PcapCtrlRegVal;
 u8 SystemInitFlag;
 
 extern ImageMoverType MoveImage;
+extern ImageMoverVType MoveImageV;
+extern ImageMoverStepType MoveImageStep;
 extern XDcfg *DcfgInstPtr;
 extern u8 BitstreamFlag;
 #ifdef XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR
@@ -245,6 +287,17 @@ int main(void)
 	u32 HandoffAddress = 0;
 	u32 Status = XST_SUCCESS;
 
+	/*
+	 * Start the boot timeline
+	 */
+	TimelineInit();
+	TimelineMark(TIMELINE_FSBL_ENTRY, 0, 0);
+
+	/*
+	 * Start the PMU counters used by the profiling scopes
+	 */
+	PmuInit();
+
 	/*
 	 * PCW initialization for MIO,PLL,CLK and DDR
 	 */
@@ -259,6 +312,10 @@ int main(void)
 		 */
 		FsblHookFallback();
 	}
+	TimelineMark(TIMELINE_PS7_INIT, 0, ps7_warm_boot);
+	if (ps7_warm_boot) {
+		fsbl_printf(DEBUG_GENERAL,"Warm reset, PLL and DDR init skipped\r\n");
+	}
 
 	fsbl_printf(DEBUG_GENERAL,"\n\r\n\r\n\rFirst ps7_init() is Done. \n\r" );
 	GpioPolledExampleInit( );
@@ -294,7 +351,13 @@ int main(void)
 	 * Register the Exception handlers
 	 */
 	RegisterHandlers();
-	
+
+	/*
+	 * Switch the console to interrupt driven output, fsbl_printf
+	 * stays synchronous if this fails
+	 */
+	ConsoleInit();
+
 	/*
 	 * Print the FSBL Banner
 	 */
@@ -305,6 +368,27 @@ int main(void)
 
 #ifdef XPAR_PS7_DDR_0_S_AXI_BASEADDR
 
+#ifdef PS7_DDR_TRAIN_CACHE
+	/*
+	 * DDR set up from a cached training record has to pass the memory
+	 * test, train again otherwise. A good result is left in OCM for the
+	 * next boot. DDRInitCheck() does not repeat line checks that passed.
+	 */
+	Status = DdrTestLines();
+	if ((Status != XST_SUCCESS) && ps7_ddr_trained) {
+		fsbl_printf(DEBUG_GENERAL,"DDR training record failed, retraining\r\n");
+		if (ps7_ddr_retrain() == FSBL_PS7_INIT_SUCCESS) {
+			Status = DdrTestLines();
+		}
+	}
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"DDR_INIT_FAIL \r\n");
+		OutputStatus(DDR_INIT_FAIL);
+		FsblHookFallback();
+	}
+	ps7_ddr_train_commit();
+#endif
+
     /*
      * DDR Read/write test 
      */
@@ -319,6 +403,7 @@ int main(void)
 		 */
 		FsblHookFallback();
 	}
+	TimelineMark(TIMELINE_DDR_CHECK, 0, ps7_ddr_trained);
 
 
 #if 1
@@ -340,8 +425,17 @@ int main(void)
 		FsblHookFallback();
 	}
 
+	TimelineMark(TIMELINE_PCAP_INIT, 0, 0);
 	fsbl_printf(DEBUG_INFO,"Devcfg driver initialized \r\n");
 
+	/*
+	 * DMAC copy service, the copies stay on the CPU if it fails
+	 */
+	Status = DmaInit();
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"DMAC init failed, CPU copies\r\n");
+	}
+
 	/*
 	 * Get the Silicon Version
 	 */
@@ -416,7 +510,22 @@ int main(void)
 		fsbl_printf(DEBUG_GENERAL,"Boot mode is QSPI\n\r");
 		InitQspi();
 		MoveImage = QspiAccess;
+		MoveImageV = QspiAccessV;
 		fsbl_printf(DEBUG_INFO,"QSPI Init Done \r\n");
+#if defined(PS7_DDR_TRAIN_CACHE) && defined(PS7_DDR_TRAIN_FLASH_OFFSET)
+		/*
+		 * A fresh DDR training result passed the memory test, store it
+		 * for the next power on
+		 */
+		if (!ps7_ddr_trained) {
+			Status = QspiFlashWrite(PS7_DDR_TRAIN_FLASH_OFFSET,
+					(const u8 *)PS7_DDR_TRAIN_ADDR,
+					sizeof(ps7_ddr_train_t));
+			fsbl_printf(DEBUG_INFO,"DDR training record %s\r\n",
+					(Status == XST_SUCCESS) ? "stored in flash" :
+					"not stored");
+		}
+#endif
 	} else
 #endif
 
@@ -427,8 +536,8 @@ int main(void)
 	if (BootModeRegister == NAND_FLASH_MODE) {
 		/*
 	 	* Boot ROM always initialize the nand at lower speed
-	 	* This is the chance to put it to an optimum speed for your nand
-	 	* device
+	 	* InitNand moves it to the fastest ONFI timing mode of the
+	 	* device when NAND_SMC_CLK_HZ is defined
 	 	*/
 		fsbl_printf(DEBUG_GENERAL,"Boot mode is NAND\n");
 
@@ -442,6 +551,7 @@ int main(void)
 			FsblFallback();
 		}
 		MoveImage = NandAccess;
+		MoveImageV = NandAccessV;
 		fsbl_printf(DEBUG_INFO,"NAND Init Done \r\n");
 	} else
 #endif
@@ -459,6 +569,7 @@ int main(void)
 		InitNor();
 		fsbl_printf(DEBUG_INFO,"NOR Init Done \r\n");
 		MoveImage = NorAccess;
+		MoveImageV = NorAccessV;
 	} else
 
 	/*
@@ -479,6 +590,8 @@ int main(void)
 			FsblFallback();
 		}
 		MoveImage = SDAccess;
+		MoveImageV = SDAccessV;
+		MoveImageStep = SDAccessStep;
 		fsbl_printf(DEBUG_INFO,"SD Init Done \r\n");
 	} else
 
@@ -495,6 +608,8 @@ int main(void)
 			FsblFallback();
 		}
 		MoveImage = SDAccess;
+		MoveImageV = SDAccessV;
+		MoveImageStep = SDAccessStep;
 		fsbl_printf(DEBUG_INFO,"MMC Init Done \r\n");
 	} else
 
@@ -521,6 +636,7 @@ int main(void)
 		 */
 		SlcrLock();
 
+		ConsoleFlush();
 		FsblHandoffJtagExit();
 	} else {
 		fsbl_printf(DEBUG_GENERAL,"ILLEGAL_BOOT_MODE \r\n");
@@ -531,6 +647,8 @@ int main(void)
 		FsblFallback();
 	}
 
+	TimelineMark(TIMELINE_DEVICE_INIT, 0, BootModeRegister);
+
 	fsbl_printf(DEBUG_INFO,"Flash Base Address: 0x%08x\r\n", FlashReadBaseAddress);
 
 	/*
@@ -582,41 +700,18 @@ int main(void)
 	FsblMeasurePerfTime(tCur,tEnd);
 #endif
 
+#ifdef FSBL_DEBUG_INFO
 	// ZTE RFC Debug test.
 	// For FSBL Flash debuging.
-	fsbl_printf(DEBUG_GENERAL,"File:%s, function:%s Line:%d. \n\r",
-			__FILE__, __func__, __LINE__ );
 	QspiFlashAllStatusShow( );
-	//QspiDisableSlaveSelect( );
-#if 1
-	/*ZTE RFC board debug, delay 5s according to Bi. */
-	fsbl_printf(DEBUG_GENERAL,"Wait for %d seconds. \n\r", FSBL_WAIT_UBOOT_SECOND);
-	{
-		int i_loop;
-		for(i_loop=0; i_loop<FSBL_WAIT_UBOOT_SECOND; i_loop++)
-		{
-			sleep(1);
-            if(0== (i_loop%30) )
-            {
-                fsbl_printf(DEBUG_INFO,"%\n\r");
-            }
-            else if(0== (i_loop%10) )
-            {
-                fsbl_printf(DEBUG_INFO,"#\n\r");
-            }
-            else  if(0== (i_loop%2) )
-            {
-                fsbl_printf(DEBUG_INFO,".");
-            }
-            else
-            {
-                fsbl_printf(DEBUG_INFO,"+");
-            }
-        }
-    }
-	fsbl_printf(DEBUG_GENERAL," Done.");
 #endif
 
+	/*
+	 * Optional delay before handoff for board debug, refer to
+	 * fsbl_bootdelay.h
+	 */
+	FsblBootDelay();
+
 #if 1
 	//
 	GpioOutputLedOff( );
@@ -656,6 +751,14 @@ void FsblFallback(void)
 	u32 HandoffAddr;
 	u32 BootModeRegister;
 
+	TimelineMark(TIMELINE_FALLBACK, 0, 0);
+
+	/*
+	 * The fallback can be taken from inside the load, write back
+	 * everything before the reset or the next image runs
+	 */
+	CacheLoadDisable();
+
 	/*
 	 * Read bootmode register
 	 */
@@ -749,6 +852,7 @@ void FsblFallback(void)
 	/*
 	 * Reset PS, so Boot ROM will restart
 	 */
+	ConsoleFlush();
 	Xil_Out32(PS_RST_CTRL_REG, PS_RST_MASK);
 }
 
@@ -769,6 +873,11 @@ void FsblHandoff(u32 FsblStartAddr)
 {
 	u32 Status;
 
+	/*
+	 * The image must be in DDR before the handoff
+	 */
+	CacheLoadDisable();
+
 	/*
 	 * Enable level shifter
 	 */
@@ -827,6 +936,10 @@ void FsblHandoff(u32 FsblStartAddr)
 	 */
 	ClearFSBLIn();
 
+	PmuReport();
+	PollReport();
+	TimelineMark(TIMELINE_HANDOFF, 0, FsblStartAddr);
+
 	if(FsblStartAddr == 0) {
 		/*
 		 * SLCR lock
@@ -834,11 +947,16 @@ void FsblHandoff(u32 FsblStartAddr)
 		SlcrLock();
 
 		fsbl_printf(DEBUG_INFO,"No Execution Address JTAG handoff \r\n");
+		TimelineFinish();
+		ConsoleFlush();
 		FsblHandoffJtagExit();
 	} else {
 		fsbl_printf(DEBUG_GENERAL,"SUCCESSFUL_HANDOFF\r\n");
 		OutputStatus(SUCCESSFUL_HANDOFF);
-		FsblHandoffExit(FsblStartAddr);
+		/*
+		 * The timeline address reaches the application in R1
+		 */
+		FsblHandoffExit(FsblStartAddr, TimelineFinish());
 	}
 
 	OutputStatus(ILLEGAL_RETURN);
@@ -870,6 +988,7 @@ void OutputStatus(u32 State)
 	 * If this is not done some of the prints will not appear on the
 	 * serial output
 	 */
+	ConsoleFlush();
 	UartReg = Xil_In32(STDOUT_BASEADDRESS + XUARTPS_SR_OFFSET);
 	while ((UartReg & XUARTPS_SR_TXEMPTY) != XUARTPS_SR_TXEMPTY) {
 		UartReg = Xil_In32(STDOUT_BASEADDRESS + XUARTPS_SR_OFFSET);
@@ -922,6 +1041,14 @@ void *(memcpy_rom)(void * s1, const void * s2, u32 n)
 	char *dst = (char *)s1;
 	const char *src = (char *)s2;
 
+	/*
+	 * DMAC copy, the CPU does the short ones
+	 */
+	if ((DmaCopyAsync((u32)s2, (u32)s1, n) == XST_SUCCESS) &&
+			(DmaWait() == XST_SUCCESS)) {
+		return s1;
+	}
+
 	/*
 	 * Loop and copy
 	 */
@@ -1384,24 +1511,33 @@ u32 HeaderChecksum(u32 FlashOffsetAddress){
 	u32 Checksum = 0;
 	u32 Count;
 	u32 TempValue = 0;
+	u32 HeaderWords[IMAGE_HEADER_CHECKSUM_COUNT];
+	MoveSegment Segments[2];
 
-	for (Count = 0; Count < IMAGE_HEADER_CHECKSUM_COUNT; Count++) {
-		/*
-		 * Read the word from the header
-		 */
-		MoveImage(FlashOffsetAddress + IMAGE_WIDTH_CHECK_OFFSET + (Count*4), (u32)&TempValue, 4);
+	/*
+	 * Read the header words and the checksum together
+	 */
+	Segments[0].SourceAddress = FlashOffsetAddress + IMAGE_WIDTH_CHECK_OFFSET;
+	Segments[0].DestinationAddress = (u32)HeaderWords;
+	Segments[0].LengthBytes = sizeof(HeaderWords);
+	Segments[1].SourceAddress = FlashOffsetAddress + IMAGE_CHECKSUM_OFFSET;
+	Segments[1].DestinationAddress = (u32)&TempValue;
+	Segments[1].LengthBytes = 4;
+	if (MoveImageV(Segments, 2) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
 
+	for (Count = 0; Count < IMAGE_HEADER_CHECKSUM_COUNT; Count++) {
 		/*
 		 * Update checksum
 		 */
-		Checksum += TempValue;
+		Checksum += HeaderWords[Count];
 	}
 
 	/*
 	 * Invert checksum, last bit of error checking
 	 */
 	Checksum ^= 0xFFFFFFFF;
-	MoveImage(FlashOffsetAddress + IMAGE_CHECKSUM_OFFSET, (u32)&TempValue, 4);
 
 	/*
 	 * Validate the checksum
@@ -1446,6 +1582,83 @@ u32 ImageCheckID(u32 FlashOffsetAddress){
 	return XST_SUCCESS;
 }
 
+#ifdef FSBL_IMAGE_DIRECTORY
+/******************************************************************************
+*
+* This function looks the next valid image up in the image directory. The
+* listed offsets from StartAddr on are checked in increasing order, with
+* the XLNX pattern and the header checksum as in the flash search.
+*
+* @param	StartAddr is the offset the search starts at
+* @param	EndAddr is the end of the boot device
+* @param	ImageAddr is set to the offset of the image found
+*
+* @return
+*		- XST_SUCCESS if a listed image is valid
+*		- XST_FAILURE if the directory is missing or corrupted or none
+*		  of its images is valid
+*
+* @note		Offsets not on a GOLDEN_IMAGE_OFFSET boundary are ignored,
+*		the multiboot register cannot point at them.
+*
+*******************************************************************************/
+static u32 ImageDirectoryFind(u32 StartAddr, u32 EndAddr, u32 *ImageAddr)
+{
+	ImageDirectory Directory;
+	u32 *Words = (u32 *)&Directory;
+	u32 Checksum = 0;
+	u32 Index;
+	u32 Offset;
+	u32 Candidate;
+
+	if (MoveImage(IMAGE_DIRECTORY_OFFSET, (u32)&Directory,
+			sizeof(Directory)) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0; Index < ((sizeof(Directory) / 4) - 1); Index++) {
+		Checksum += Words[Index];
+	}
+
+	if ((Directory.Magic != IMAGE_DIRECTORY_MAGIC) ||
+			(Directory.Count > IMAGE_DIRECTORY_ENTRIES) ||
+			(Directory.Checksum != (Checksum ^ 0xFFFFFFFF))) {
+		fsbl_printf(DEBUG_INFO, "\r\nNo image directory\r\n");
+		return XST_FAILURE;
+	}
+
+	while (StartAddr < EndAddr) {
+		/*
+		 * Lowest listed offset not yet checked
+		 */
+		Candidate = EndAddr;
+		for (Index = 0; Index < Directory.Count; Index++) {
+			Offset = Directory.Offset[Index];
+			if ((Offset >= StartAddr) && (Offset < Candidate) &&
+					((Offset & (GOLDEN_IMAGE_OFFSET - 1)) == 0) &&
+					(((Offset / GOLDEN_IMAGE_OFFSET) &
+					~PCAP_MBOOT_REG_REBOOT_OFFSET_MASK) == 0)) {
+				Candidate = Offset;
+			}
+		}
+		if (Candidate == EndAddr) {
+			break;
+		}
+
+		if ((ImageCheckID(Candidate) == XST_SUCCESS) &&
+				(HeaderChecksum(Candidate) == XST_SUCCESS)) {
+			*ImageAddr = Candidate;
+			return XST_SUCCESS;
+		}
+
+		StartAddr = Candidate + GOLDEN_IMAGE_OFFSET;
+	}
+
+	fsbl_printf(DEBUG_INFO, "\r\nNo valid image in the directory\r\n");
+
+	return XST_FAILURE;
+}
+#endif
 
 /******************************************************************************
 *
@@ -1457,14 +1670,19 @@ u32 ImageCheckID(u32 FlashOffsetAddress){
 *		- XST_SUCCESS if valid image found
 *		- XST_FAILURE if no image found
 *
-* @note		None
+* @note		With FSBL_IMAGE_DIRECTORY the image directory is looked at
+*		first, the flash is searched when it gives no image.
 *
 *******************************************************************************/
 u32 NextValidImageCheck(void)
 {
 	u32 ImageBaseAddr;
+#ifdef FSBL_IMAGE_DIRECTORY
+	u32 DirectoryAddr;
+#endif
 	u32 MultiBootReg;
 	u32 BootDevMaxSize=0;
+	u32 SearchStep = GOLDEN_IMAGE_OFFSET;
 
 	fsbl_printf(DEBUG_GENERAL, "Searching For Next Valid Image");
 	
@@ -1477,9 +1695,14 @@ u32 NextValidImageCheck(void)
 	}
 #endif
 
+#ifdef XPAR_PS7_NAND_0_BASEADDR
 	if (FlashReadBaseAddress == XPS_NAND_BASEADDR) {
-		BootDevMaxSize  = NAND_FLASH_SIZE;
+		/*
+		 * Images start on an erase block, only the good blocks count
+		 */
+		NandSearchGeometry(&BootDevMaxSize, &SearchStep);
 	}
+#endif
 
 	if (FlashReadBaseAddress == XPS_NOR_BASEADDR) {
 		BootDevMaxSize  = NOR_FLASH_SIZE;
@@ -1496,10 +1719,27 @@ u32 NextValidImageCheck(void)
 	 */
 	ImageBaseAddr = (MultiBootReg & PCAP_MBOOT_REG_REBOOT_OFFSET_MASK)
 								* GOLDEN_IMAGE_OFFSET;
+
+#ifdef FSBL_IMAGE_DIRECTORY
+	if (ImageDirectoryFind(ImageBaseAddr, BootDevMaxSize,
+			&DirectoryAddr) == XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,
+				"\r\nImage found in the directory, offset: 0x%.8x\r\n",
+				DirectoryAddr);
+		MultiBootReg = (MultiBootReg & ~PCAP_MBOOT_REG_REBOOT_OFFSET_MASK) |
+				(DirectoryAddr / GOLDEN_IMAGE_OFFSET);
+		XDcfg_WriteReg(DcfgInstPtr->Config.BaseAddr,
+				XDCFG_MULTIBOOT_ADDR_OFFSET,
+				MultiBootReg);
+
+		return XST_SUCCESS;
+	}
+#endif
 	
 	/*
 	 * Valid image search continue till end of the flash
-	 * With increment 32KB in each iteration
+	 * With increment SearchStep in each iteration, 32KB or the NAND
+	 * erase block
 	 */
 	while (ImageBaseAddr < BootDevMaxSize) {
 
@@ -1525,9 +1765,17 @@ u32 NextValidImageCheck(void)
 		}
 
 		/*
-		 * Increment mulitboot count
+		 * Increment mulitboot count to the next step boundary
 		 */
-		MultiBootReg++;
+		MultiBootReg += (SearchStep - (ImageBaseAddr & (SearchStep - 1))) /
+				GOLDEN_IMAGE_OFFSET;
+
+		/*
+		 * The multiboot offset does not reach past its wrap
+		 */
+		if ((MultiBootReg & PCAP_MBOOT_REG_REBOOT_OFFSET_MASK) == 0) {
+			break;
+		}
 
 		/*
 		 * Compute the image start address
@@ -1550,32 +1798,12 @@ u32 NextValidImageCheck(void)
 *		- XST_SUCCESS if the initialization is successful
 *		- XST_FAILURE if the  initialization is NOT successful
 *
-* @note		None.
+* @note		Runs the DDR test within FSBL_DDR_TEST_BUDGET_US. After a
+*		warm reset that kept DDR running only the line checks are done,
+*		they restore every word they write so the contents survive.
 *
 ****************************************************************************/
 u32 DDRInitCheck(void)
 {
-	u32 ReadVal;
-
-	/*
-	 * Write and Read from the DDR location for sanity checks
-	 */
-	Xil_Out32(DDR_START_ADDR, DDR_TEST_PATTERN);
-	ReadVal = Xil_In32(DDR_START_ADDR);
-	if (ReadVal != DDR_TEST_PATTERN) {
-		fsbl_printf(DEBUG_INFO,"DDRInitCheck first ReadVal: 0x%08x is error.\r\n",ReadVal);
-		return XST_FAILURE;
-	}
-
-	/*
-	 * Write and Read from the DDR location for sanity checks
-	 */
-	Xil_Out32(DDR_START_ADDR + DDR_TEST_OFFSET, DDR_TEST_PATTERN);
-	ReadVal = Xil_In32(DDR_START_ADDR + DDR_TEST_OFFSET);
-	if (ReadVal != DDR_TEST_PATTERN) {
-		fsbl_printf(DEBUG_INFO,"DDRInitCheck second ReadVal: 0x%08x is error.\r\n",ReadVal);
-		return XST_FAILURE;
-	}
-
-	return XST_SUCCESS;
+	return DdrTest(ps7_warm_boot ? 0 : FSBL_DDR_TEST_BUDGET_US);
 }
@@ -77,6 +77,7 @@
 /****************************** Include Files *********************************/
 
 #include "md5.h"
+#include "fsbl_pmu.h"
 
 /******************************************************************************/
 /**
@@ -476,9 +477,13 @@ void md5( u8 *input, u32 len, u8 *digest, boolean doByteSwap )
 {
 	MD5Context context;
 
+	PMU_SCOPE_BEGIN(PMU_SCOPE_MD5);
+
 	MD5Init( &context );
 	
 	MD5Update( &context, input, len, doByteSwap );
 	
 	MD5Final( &context, digest, doByteSwap );
+
+	PMU_SCOPE_END(PMU_SCOPE_MD5);
 }
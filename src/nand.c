@@ -46,6 +46,12 @@
 * 2.00a  mb	25/05/12 fsbl changes for standalone bsp based
 * 3.00a sgd	30/01/13 Code cleanup
 * 5.00a sgd	17/05/13 Support for Multi Boot
+* 12.00a hx	10/18/26 Bad blocks are looked up in a map built by InitNand
+*						ONFI timing mode upgrade, reads span good blocks
+*						Added NandSearchGeometry for the image search
+*						Added NandAccessV
+*						Whole pages are read with the ONFI read cache
+*						commands and the SMC ECC
 * </pre>
 *
 * @note
@@ -58,20 +64,127 @@
 #ifdef XPAR_PS7_NAND_0_BASEADDR
 #include "nand.h"
 #include "xnandps_bbm.h"
+#include "fsbl_pmu.h"
+#include "fsbl_poll.h"
+#include "xil_io.h"
 
 
 /************************** Constant Definitions *****************************/
 
 #define NAND_DEVICE_ID		XPAR_XNANDPS_0_DEVICE_ID
 
+/*
+ * Gap in bytes NandAccessV reads through, a page read costs the same for
+ * any part of the page
+ */
+#define NAND_MOVE_V_GAP		2048
+
+/*
+ * SMC registers, set_cycles is applied to chip 0 of interface 1 (NAND)
+ * with an UpdateRegs direct command
+ */
+#define NAND_SMC_STATUS_OFFSET		0x000
+#define NAND_SMC_CLR_CONFIG_OFFSET	0x00C
+#define NAND_SMC_DIRECT_CMD_OFFSET	0x010
+#define NAND_SMC_SET_CYCLES_OFFSET	0x014
+#define NAND_SMC_UPDATE_REGS		((0x4 << 23) | (0x2 << 21))
+#define NAND_SMC_RAW_INT1			0x00000040
+#define NAND_SMC_INT_CLR1			0x00000010
+
+/*
+ * SMC ECC block of interface 1, a 3 byte ECC per 512 byte block of a 2048
+ * byte page, stored in the last 12 spare bytes
+ */
+#define NAND_ECC_STATUS_OFFSET		0x400
+#define NAND_ECC_MEMCFG_OFFSET		0x404
+#define NAND_ECC_VALUE_OFFSET(n)	(0x418 + ((n) * 4))
+#define NAND_ECC_BUSY				0x00000040
+#define NAND_ECC_MODE_MASK			0x0000000C
+#define NAND_ECC_MODE_MEM			0x00000008
+#define NAND_ECC_PAGE_SIZE_MASK		0x00000003
+#define NAND_ECC_PAGE_SIZE_2048		0x00000003
+#define NAND_ECC_VALID				0x40000000
+#define NAND_ECC_BLOCK_SIZE			512
+#define NAND_ECC_BLOCKS				4
+#define NAND_ECC_BYTES				3
+#define NAND_CACHE_PAGE_SIZE		2048
+#define NAND_CACHE_SPARE_SIZE		64
+#define NAND_CACHE_ECC_OFFSET		52
+
+/*
+ * Command and data phase address fields
+ */
+#define NAND_ADDR_CYCLES_SHIFT		21
+#define NAND_END_CMD_VALID			0x00100000
+#define NAND_END_CMD_SHIFT			11
+#define NAND_START_CMD_SHIFT		3
+#define NAND_DATA_PHASE				0x00080000
+#define NAND_CLEAR_CS				0x00200000
+#define NAND_ECC_LAST				0x00000400
+
+/*
+ * ONFI commands and parameter page layout
+ */
+#define ONFI_CMD_READ_MODE			0x00
+#define ONFI_CMD_READ_START			0x30
+#define ONFI_CMD_READ_CACHE_SEQ		0x31
+#define ONFI_CMD_READ_CACHE_END		0x3F
+#define ONFI_CMD_READ_STATUS		0x70
+#define ONFI_CMD_READ_PARAM			0xEC
+#define ONFI_CMD_SET_FEATURES		0xEF
+#define ONFI_STATUS_READY			0x40
+#define ONFI_FEATURE_TIMING			0x01
+#define ONFI_PARAM_SIZE				256
+#define ONFI_PARAM_OPT_CMDS			8
+#define ONFI_PARAM_TIMING_MODES		129
+#define ONFI_PARAM_CRC				254
+#define ONFI_OPT_READ_CACHE			0x0002
+#define ONFI_CRC_INIT				0x4F4E
+#define ONFI_CRC_POLY				0x8005
+#define ONFI_MAX_MODE				5
+
+#ifdef NAND_SMC_CLK_HZ
+#define NAND_SMC_CLK_MHZ			(NAND_SMC_CLK_HZ / 1000000)
+#endif
+
 /**************************** Type Definitions *******************************/
+#ifdef NAND_SMC_CLK_HZ
+/*
+ * ONFI timing mode parameters in ns: tRC, tWC, tREA, tWP, tCLR, tAR, tRR
+ */
+typedef struct {
+	u8 Trc;
+	u8 Twc;
+	u8 Trea;
+	u8 Twp;
+	u8 Tclr;
+	u8 Tar;
+	u8 Trr;
+} OnfiTiming;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
-static u32 XNandPs_CalculateLength(XNandPs *NandInstPtr,
-										u64 Offset,
-										u32 Length);
+static void NandBuildBlockMap(void);
+static u32 NandIsBlockBad(u32 Block);
+static u32 NandGoodBlock(u32 Logical);
+static u32 NandNextGoodBlock(u32 Block);
+static u32 NandRead(u64 Offset, u32 Length, u8 *BufPtr);
+static u32 NandReadCache(u32 Page, u32 Pages, u32 *BufPtr);
+static u32 NandReadPageEcc(u32 *BufPtr);
+static u32 NandEccCorrect(const u8 *Stored, u32 Calc, u8 *BufPtr);
+static u32 NandReadParamPage(u8 *Param);
+static void NandReadCacheSetup(const u8 *Param);
+#ifdef NAND_SMC_CLK_HZ
+static void NandTimingUpgrade(const u8 *Param);
+static u32 NandSetCycles(const OnfiTiming *Timing);
+#endif
+static void NandCommand(u32 Command, u32 AddrCycles, u32 Address);
+static void NandCommandPage(u32 Page);
+static u32 NandWaitReady(void);
+static u32 NandWaitBusy(void);
+static u16 OnfiCrc16(const u8 *Buf, u32 Length);
 
 /************************** Variable Definitions *****************************/
 
@@ -81,6 +194,31 @@ extern u32 FlashOffsetAddress;
 XNandPs *NandInstPtr;
 XNandPs NandInstance; /* XNand Instance. */
 
+/*
+ * Bad block map, a bit per block and the bad blocks before each word
+ */
+static u32 BadBlockMap[NAND_MAP_MAX_BLOCKS / 32];
+static u16 BadBlocksBefore[NAND_MAP_MAX_BLOCKS / 32];
+static u32 MapBlocks;
+static u32 MapBadBlocks;
+
+/*
+ * Set by InitNand when whole pages can be read with the read cache
+ * commands: ONFI device with read cache, 2048 byte pages, SMC ECC
+ */
+static u32 NandCacheRead;
+
+#ifdef NAND_SMC_CLK_HZ
+static const OnfiTiming OnfiTimingMode[ONFI_MAX_MODE + 1] = {
+	{100, 100, 40, 50, 20, 25, 40},
+	{ 50,  45, 30, 25, 10, 10, 20},
+	{ 35,  35, 25, 17, 10, 10, 20},
+	{ 30,  30, 20, 15, 10, 10, 20},
+	{ 25,  25, 20, 12, 10, 10, 20},
+	{ 20,  20, 16, 10, 10, 10, 20},
+};
+#endif
+
 /******************************************************************************/
 /**
 *
@@ -100,6 +238,7 @@ u32 InitNand(void)
 
 	u32 Status;
 	XNandPs_Config *ConfigPtr;
+	u32 ParamPage[ONFI_PARAM_SIZE / 4];
 
 	/*
 	 * Set up pointers to instance and the config structure
@@ -137,6 +276,23 @@ u32 InitNand(void)
 		return XST_FAILURE;
 	}
 
+	/*
+	 * Boot ROM always initialize the nand at lower speed, move to the
+	 * fastest timing mode of the device. Use the read cache commands
+	 * when the device has them.
+	 */
+	if (NandReadParamPage((u8 *)ParamPage) == XST_SUCCESS) {
+#ifdef NAND_SMC_CLK_HZ
+		NandTimingUpgrade((u8 *)ParamPage);
+#endif
+		NandReadCacheSetup((u8 *)ParamPage);
+	}
+
+	/*
+	 * Cache the bad block table for NandAccess
+	 */
+	NandBuildBlockMap();
+
 	/*
 	 * set up the FLASH access pointers
 	 */
@@ -160,136 +316,812 @@ u32 InitNand(void)
 * @return	XST_SUCCESS if the transfer completes correctly
 *		XST_FAILURE if the transfer fails to completes correctly
 *
-* @note	none.
+* @note	The physical blocks are looked up in the bad block map, so the
+*		cost does not grow with the source address. Each run of good
+*		blocks is read with NandRead, which streams the whole pages of
+*		each block with the read cache commands.
 *
 ****************************************************************************/
 u32 NandAccess(u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 {
-	u32 ActLen;
-	u32 BlockOffset;
+	u32 BlockSize = NandInstPtr->Geometry.BlockSize;
+	u32 NumBlocks = NandInstPtr->Geometry.NumBlocks;
+	u32 BlockOffset = SourceAddress & (BlockSize - 1);
 	u32 Block;
+	u32 Span;
+	u32 ReadLen;
 	u32 Status;
 	u32 BytesLeft = LengthBytes;
-	u32 BlockSize = NandInstPtr->Geometry.BlockSize;
 	u8 *BufPtr = (u8 *)DestinationAddress;
-	u32 ReadLen;
-	u32 BlockReadLen;
-	u32 Offset;
-	u32 TmpAddress = 0 ;
-	u32 BlockCount = 0;
-	u32 BadBlocks = 0;
-
-	/*
-	 * First get bad blocks before the source address
-	 */
-	while (TmpAddress < SourceAddress) {
-		while (XNandPs_IsBlockBad(NandInstPtr, BlockCount) ==
-				XST_SUCCESS) {
-			BlockCount ++;
-			BadBlocks ++;
-		}
-
-		TmpAddress += BlockSize;
-		BlockCount ++;
-	}
 
-	Offset = SourceAddress + BadBlocks * BlockSize;
+	PMU_SCOPE_BEGIN(PMU_SCOPE_NAND_ACCESS);
 
-	/*
-	 * Calculate the actual length including bad blocks
-	 */
-	ActLen = XNandPs_CalculateLength(NandInstPtr, Offset, LengthBytes);
-
-	/*
-	 *  Check if the actual length cross flash size
-	 */
-	if (Offset + ActLen > NandInstPtr->Geometry.DeviceSize) {
-		return XST_FAILURE;
-	}
+	Block = NandGoodBlock(SourceAddress / BlockSize);
 
 	while (BytesLeft > 0) {
-		BlockOffset = Offset & (BlockSize - 1);
-		Block = (Offset & ~(BlockSize - 1))/BlockSize;
-		BlockReadLen = BlockSize - BlockOffset;
-
-		Status = XNandPs_IsBlockBad(NandInstPtr, Block);
-		if (Status == XST_SUCCESS) {
-			/* Move to next block */
-			Offset += BlockReadLen;
-			continue;
+		/*
+		 *  Check if the read crosses the flash size
+		 */
+		if (Block >= NumBlocks) {
+			PMU_SCOPE_END(PMU_SCOPE_NAND_ACCESS);
+			return XST_FAILURE;
 		}
 
 		/*
-		 * Check if we cross block boundary
+		 * Extend the read over the following good blocks, so the
+		 * pages of the whole run are read in one go
 		 */
-		if (BytesLeft < BlockReadLen) {
+		Span = Block;
+		ReadLen = BlockSize - BlockOffset;
+		while ((ReadLen < BytesLeft) && ((Span + 1) < NumBlocks) &&
+				!NandIsBlockBad(Span + 1)) {
+			Span++;
+			ReadLen += BlockSize;
+		}
+		if (BytesLeft < ReadLen) {
 			ReadLen = BytesLeft;
-		} else {
-			ReadLen = BlockReadLen;
 		}
 
 		/*
 		 * Read from the NAND flash
 		 */
-		Status = XNandPs_Read(NandInstPtr, Offset, ReadLen, BufPtr, NULL);
+		Status = NandRead(((u64)Block * BlockSize) + BlockOffset, ReadLen,
+				BufPtr);
 		if (Status != XST_SUCCESS) {
+			PMU_SCOPE_END(PMU_SCOPE_NAND_ACCESS);
 			return Status;
 		}
 		BytesLeft -= ReadLen;
-		Offset += ReadLen;
 		BufPtr += ReadLen;
+		BlockOffset = 0;
+
+		/* Move to next good block */
+		Block = NandNextGoodBlock(Span + 1);
 	}
 
+	PMU_SCOPE_END(PMU_SCOPE_NAND_ACCESS);
+
 	return XST_SUCCESS;
 }
 
-/*****************************************************************************/
+/******************************************************************************/
 /**
 *
-* This function returns the length including bad blocks from a given offset and
-* length.
+* This function is the vectored form of NandAccess, the segments are merged
+* into as few device reads as possible
 *
-* @param	NandInstPtr is the pointer to the XNandPs instance.
-* @param	Offset is the flash data address to read from.
-* @param	Length is number of bytes to read.
+* @param	Segments is the list of segments, it is sorted in place
+* @param	Count is the number of segments
 *
 * @return
-*		- Return actual length including bad blocks.
+*		- XST_SUCCESS if all the segments were read
+*		- XST_FAILURE otherwise
 *
-* @note		None.
+* @note		None
 *
-******************************************************************************/
-static u32 XNandPs_CalculateLength(XNandPs *NandInstPtr,
-									u64 Offset,
-									u32 Length)
+****************************************************************************/
+u32 NandAccessV(MoveSegment *Segments, u32 Count)
 {
+	return MoveImageVector(Segments, Count, NandAccess, NAND_MOVE_V_GAP);
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads a range of physically contiguous pages. The whole
+* pages of each block are read with the read cache commands when InitNand
+* enabled them, partial pages and single pages through the driver.
+*
+* @param	Offset is the physical byte offset in the device
+* @param	Length is the number of bytes to read
+* @param	BufPtr is the destination
+*
+* @return
+*		- XST_SUCCESS if the range was read
+*		- the driver error otherwise
+*
+* @note		If a read cache sequence fails the cache reads are turned off
+*		and its pages are read again through the driver.
+*
+****************************************************************************/
+static u32 NandRead(u64 Offset, u32 Length, u8 *BufPtr)
+{
+	u32 PageSize = NandInstPtr->Geometry.BytesPerPage;
 	u32 BlockSize = NandInstPtr->Geometry.BlockSize;
-	u32 CurBlockLen;
-	u32 CurBlock;
+	u32 Column;
+	u32 Pages;
+	u32 Count;
 	u32 Status;
-	u32 TempLen = 0;
-	u32 ActLen = 0;
 
-	while (TempLen < Length) {
-		CurBlockLen = BlockSize - (Offset & (BlockSize - 1));
-		CurBlock = (Offset & ~(BlockSize - 1))/BlockSize;
+	if (!NandCacheRead || (((u32)BufPtr & 3) != 0)) {
+		return XNandPs_Read(NandInstPtr, Offset, Length, BufPtr, NULL);
+	}
 
+	while (Length > 0) {
 		/*
-		 * Check if the block is bad
+		 * Whole pages up to the end of the block
 		 */
-		Status = XNandPs_IsBlockBad(NandInstPtr, CurBlock);
+		Column = (u32)Offset & (PageSize - 1);
+		Pages = (BlockSize - ((u32)Offset & (BlockSize - 1))) / PageSize;
+		if ((Length / PageSize) < Pages) {
+			Pages = Length / PageSize;
+		}
+
+		if ((Column != 0) || (Pages < 2) || !NandCacheRead) {
+			Count = PageSize - Column;
+			if (Count > Length) {
+				Count = Length;
+			}
+			Status = XNandPs_Read(NandInstPtr, Offset, Count, BufPtr, NULL);
+		} else {
+			Count = Pages * PageSize;
+			Status = NandReadCache((u32)(Offset / PageSize), Pages,
+					(u32 *)BufPtr);
+			if (Status != XST_SUCCESS) {
+				fsbl_printf(DEBUG_GENERAL,"NAND read cache failed at page"
+						" 0x%x, using page reads\r\n", (u32)(Offset / PageSize));
+				NandCacheRead = 0;
+				Status = XNandPs_Read(NandInstPtr, Offset, Count, BufPtr,
+						NULL);
+			}
+		}
 		if (Status != XST_SUCCESS) {
-			/* Good Block */
-			TempLen += CurBlockLen;
+			return Status;
+		}
+
+		Offset += Count;
+		BufPtr += Count;
+		Length -= Count;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads whole pages of one block with READ CACHE SEQUENTIAL,
+* so the array read of each page overlaps the transfer of the previous
+* one. The last page is taken with READ CACHE END.
+*
+* @param	Page is the first page
+* @param	Pages is the number of pages, at least 2
+* @param	BufPtr is the word aligned destination
+*
+* @return
+*		- XST_SUCCESS if all the pages were read and passed the ECC check
+*		- XST_FAILURE otherwise
+*
+* @note		The ready waits use the SMC busy interrupt, a READ STATUS
+*		would put the status bytes in the SMC ECC of the page.
+*
+****************************************************************************/
+static u32 NandReadCache(u32 Page, u32 Pages, u32 *BufPtr)
+{
+	u32 Index;
+
+	NandCommandPage(Page);
+	if (NandWaitBusy() != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0; Index < Pages; Index++) {
+		NandCommand(((Index + 1) < Pages) ? ONFI_CMD_READ_CACHE_SEQ :
+				ONFI_CMD_READ_CACHE_END, 0, 0);
+		if (NandWaitBusy() != XST_SUCCESS) {
+			return XST_FAILURE;
 		}
-		ActLen += CurBlockLen;
-		Offset += CurBlockLen;
-		if (Offset >= NandInstPtr->Geometry.DeviceSize) {
+
+		if (NandReadPageEcc(BufPtr) != XST_SUCCESS) {
+			if ((Index + 1) < Pages) {
+				/*
+				 * End the sequence, the page read ahead is dropped
+				 */
+				NandCommand(ONFI_CMD_READ_CACHE_END, 0, 0);
+				(void)NandWaitBusy();
+			}
+			return XST_FAILURE;
+		}
+		BufPtr += NAND_CACHE_PAGE_SIZE / 4;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function transfers a page from the cache register, the SMC ECC block
+* computes the ECC of its data phases, which is then checked against the
+* ECC stored in the spare area
+*
+* @param	BufPtr is the word aligned destination
+*
+* @return
+*		- XST_SUCCESS if the page is good or was corrected
+*		- XST_FAILURE on an uncorrectable error or no ECC from the SMC
+*
+* @note		None
+*
+****************************************************************************/
+static u32 NandReadPageEcc(u32 *BufPtr)
+{
+	u32 DataPhase = NandInstPtr->Config.FlashBase | NAND_DATA_PHASE;
+	u32 SmcBase = NandInstPtr->Config.SmcBase;
+	u32 Spare[NAND_CACHE_SPARE_SIZE / 4];
+	u8 *SpareBytes = (u8 *)Spare;
+	PollDeadline Poll;
+	u32 Index;
+	u32 Value;
+	u32 Status = XST_SUCCESS;
+
+	for (Index = 0; Index < (NAND_CACHE_PAGE_SIZE / 4) - 1; Index++) {
+		BufPtr[Index] = Xil_In32(DataPhase);
+	}
+	BufPtr[Index] = Xil_In32(DataPhase | NAND_ECC_LAST);
+
+	for (Index = 0; Index < (NAND_CACHE_SPARE_SIZE / 4) - 1; Index++) {
+		Spare[Index] = Xil_In32(DataPhase);
+	}
+	Spare[Index] = Xil_In32(DataPhase | NAND_CLEAR_CS);
+
+	PollStart(&Poll, POLL_SITE_NAND_READY);
+	while ((Xil_In32(SmcBase + NAND_ECC_STATUS_OFFSET) & NAND_ECC_BUSY) != 0) {
+		if (PollExpired(&Poll)) {
+			Status = XST_FAILURE;
 			break;
 		}
 	}
+	PollEnd(&Poll);
+
+	for (Index = 0; (Status == XST_SUCCESS) && (Index < NAND_ECC_BLOCKS);
+			Index++) {
+		Value = Xil_In32(SmcBase + NAND_ECC_VALUE_OFFSET(Index));
+		if ((Value & NAND_ECC_VALID) == 0) {
+			Status = XST_FAILURE;
+			break;
+		}
+		Status = NandEccCorrect(
+				&SpareBytes[NAND_CACHE_ECC_OFFSET + (Index * NAND_ECC_BYTES)],
+				~Value, (u8 *)BufPtr + (Index * NAND_ECC_BLOCK_SIZE));
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function checks a 512 byte block against its stored Hamming ECC and
+* corrects a single bit error
+*
+* @param	Stored is the ECC read from the spare area
+* @param	Calc is the ECC computed by the SMC, in bits 23:0
+* @param	BufPtr is the block
+*
+* @return
+*		- XST_SUCCESS if the block is good or was corrected
+*		- XST_FAILURE on an uncorrectable error
+*
+* @note		The low 12 bits of an ECC are the odd parities, the high 12 bits
+*		the even ones. A single data bit error flips the one at the bit
+*		position in the odd parities and its complement in the even ones.
+*
+****************************************************************************/
+static u32 NandEccCorrect(const u8 *Stored, u32 Calc, u8 *BufPtr)
+{
+	u32 Read = Stored[0] | (Stored[1] << 8) | (Stored[2] << 16);
+	u32 Odd = (Read ^ Calc) & 0xFFF;
+	u32 Even = ((Read ^ Calc) >> 12) & 0xFFF;
+
+	if ((Odd == 0) && (Even == 0)) {
+		return XST_SUCCESS;
+	}
+
+	if (Odd == (~Even & 0xFFF)) {
+		BufPtr[(Odd >> 3) & 0x1FF] ^= (u8)(1 << (Odd & 0x7));
+		return XST_SUCCESS;
+	}
+
+	/*
+	 * A single bit error in the stored ECC itself
+	 */
+	if (((Odd | Even) & ((Odd | Even) - 1)) == 0) {
+		return XST_SUCCESS;
+	}
+
+	return XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds the bad block map from the driver bad block table:
+* a bit per block, and per 32 blocks the number of bad blocks before them.
+*
+* @param	None
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+static void NandBuildBlockMap(void)
+{
+	u32 Block;
+	u32 Bad = 0;
+
+	MapBlocks = NandInstPtr->Geometry.NumBlocks;
+	if (MapBlocks > NAND_MAP_MAX_BLOCKS) {
+		MapBlocks = NAND_MAP_MAX_BLOCKS;
+	}
+
+	for (Block = 0; Block < MapBlocks; Block++) {
+		if ((Block & 31) == 0) {
+			BadBlockMap[Block >> 5] = 0;
+			BadBlocksBefore[Block >> 5] = (u16)Bad;
+		}
+		if (XNandPs_IsBlockBad(NandInstPtr, Block) == XST_SUCCESS) {
+			BadBlockMap[Block >> 5] |= (u32)1 << (Block & 31);
+			Bad++;
+		}
+	}
+
+	MapBadBlocks = Bad;
+
+	fsbl_printf(DEBUG_INFO,"InitNand: %d bad blocks in %d\r\n",
+			Bad, MapBlocks);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function gives the range and the stride of the image search on NAND
+*
+* @param	Size is set to the bytes held by the good blocks, the end of
+*		the address range NandAccess covers
+* @param	Step is set to the erase block size, at least GOLDEN_IMAGE_OFFSET
+*
+* @return	None
+*
+* @note		The addresses are logical, NandAccess skips the bad blocks.
+*
+******************************************************************************/
+void NandSearchGeometry(u32 *Size, u32 *Step)
+{
+	u32 BlockSize = NandInstPtr->Geometry.BlockSize;
+	u64 GoodSize;
+
+	GoodSize = (u64)(NandInstPtr->Geometry.NumBlocks - MapBadBlocks) *
+			BlockSize;
+	if (GoodSize > 0xFFFFFFFF) {
+		GoodSize = 0xFFFFFFFF;
+	}
+
+	*Size = (u32)GoodSize;
+	*Step = (BlockSize > GOLDEN_IMAGE_OFFSET) ? BlockSize : GOLDEN_IMAGE_OFFSET;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks a block in the bad block map
+*
+* @param	Block is the physical block number
+*
+* @return	1 if the block is bad, 0 otherwise
+*
+* @note		None
+*
+******************************************************************************/
+static u32 NandIsBlockBad(u32 Block)
+{
+	if (Block < MapBlocks) {
+		return (BadBlockMap[Block >> 5] >> (Block & 31)) & 1;
+	}
+
+	return (XNandPs_IsBlockBad(NandInstPtr, Block) == XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the physical block of a good block number, that is
+* the block number counting good blocks only.
+*
+* @param	Logical is the good block number
+*
+* @return	Physical block number, Geometry.NumBlocks if there is none
+*
+* @note		A binary search over the per word counts finds the 32 block
+*		word holding the block.
+*
+******************************************************************************/
+static u32 NandGoodBlock(u32 Logical)
+{
+	u32 Low = 0;
+	u32 High = (MapBlocks + 31) >> 5;
+	u32 Mid;
+	u32 Block;
+	u32 Good;
+
+	while ((High - Low) > 1) {
+		Mid = (Low + High) >> 1;
+		if (((Mid << 5) - BadBlocksBefore[Mid]) <= Logical) {
+			Low = Mid;
+		} else {
+			High = Mid;
+		}
+	}
+
+	Block = Low << 5;
+	Good = Block - BadBlocksBefore[Low];
+	for (;;) {
+		Block = NandNextGoodBlock(Block);
+		if ((Block >= NandInstPtr->Geometry.NumBlocks) || (Good == Logical)) {
+			return Block;
+		}
+		Good++;
+		Block++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function skips bad blocks
+*
+* @param	Block is the physical block to start from
+*
+* @return	First good block from Block on, Geometry.NumBlocks if there
+*		is none
+*
+* @note		None
+*
+******************************************************************************/
+static u32 NandNextGoodBlock(u32 Block)
+{
+	while ((Block < NandInstPtr->Geometry.NumBlocks) &&
+			NandIsBlockBad(Block)) {
+		Block++;
+	}
+
+	return Block;
+}
+
+
+/*****************************************************************************/
+/**
+*
+* This function reads and checks the ONFI parameter page
+*
+* @param	Param is the ONFI_PARAM_SIZE byte, word aligned buffer
+*
+* @return
+*		- XST_SUCCESS if the page has the ONFI signature and a good CRC
+*		- XST_FAILURE otherwise, and for 16 bit devices
+*
+* @note		None
+*
+******************************************************************************/
+static u32 NandReadParamPage(u8 *Param)
+{
+	u32 *ParamPage = (u32 *)Param;
+	u32 FlashBase = NandInstPtr->Config.FlashBase;
+	u32 Index;
+
+	if (NandInstPtr->Config.FlashWidth != 8) {
+		return XST_FAILURE;
+	}
+
+	NandCommand(ONFI_CMD_READ_PARAM, 1, 0x00);
+	if (NandWaitReady() != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"InitNand: parameter page timeout\r\n");
+		return XST_FAILURE;
+	}
+	NandCommand(ONFI_CMD_READ_MODE, 0, 0);
+
+	for (Index = 0; Index < (ONFI_PARAM_SIZE / 4) - 1; Index++) {
+		ParamPage[Index] = Xil_In32(FlashBase | NAND_DATA_PHASE);
+	}
+	ParamPage[Index] = Xil_In32(FlashBase | NAND_DATA_PHASE | NAND_CLEAR_CS);
+
+	if ((Param[0] != 'O') || (Param[1] != 'N') ||
+			(Param[2] != 'F') || (Param[3] != 'I') ||
+			(OnfiCrc16(Param, ONFI_PARAM_CRC) != (Param[ONFI_PARAM_CRC] |
+					(Param[ONFI_PARAM_CRC + 1] << 8)))) {
+		fsbl_printf(DEBUG_INFO,"InitNand: no ONFI parameter page\r\n");
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function turns on the read cache reads when the device supports the
+* read cache commands and the driver set the SMC ECC block up for 2048 byte
+* pages
+*
+* @param	Param is the ONFI parameter page
+*
+* @return	None
+*
+* @note		Devices with on-die ECC or other page sizes keep the driver
+*		page reads.
+*
+******************************************************************************/
+static void NandReadCacheSetup(const u8 *Param)
+{
+	u32 OptCmds = Param[ONFI_PARAM_OPT_CMDS] |
+			(Param[ONFI_PARAM_OPT_CMDS + 1] << 8);
+	u32 EccCfg = Xil_In32(NandInstPtr->Config.SmcBase +
+			NAND_ECC_MEMCFG_OFFSET);
+
+	NandCacheRead = ((OptCmds & ONFI_OPT_READ_CACHE) != 0) &&
+			((EccCfg & NAND_ECC_MODE_MASK) == NAND_ECC_MODE_MEM) &&
+			((EccCfg & NAND_ECC_PAGE_SIZE_MASK) == NAND_ECC_PAGE_SIZE_2048) &&
+			(NandInstPtr->Geometry.BytesPerPage == NAND_CACHE_PAGE_SIZE) &&
+			(NandInstPtr->Geometry.SpareBytesPerPage ==
+					NAND_CACHE_SPARE_SIZE);
+
+	fsbl_printf(DEBUG_INFO,"InitNand: read cache %s\r\n",
+			NandCacheRead ? "on" : "off");
+}
+
+#ifdef NAND_SMC_CLK_HZ
+/*****************************************************************************/
+/**
+*
+* This function moves the device and the SMC to the fastest timing mode both
+* support. The device is switched first, the SMC timing left by the BootROM
+* is slower than any ONFI mode.
+*
+* @param	Param is the ONFI parameter page
+*
+* @return	None
+*
+* @note		On any error the BootROM timing is kept.
+*
+******************************************************************************/
+static void NandTimingUpgrade(const u8 *Param)
+{
+	u32 FlashBase = NandInstPtr->Config.FlashBase;
+	u32 SmcBase = NandInstPtr->Config.SmcBase;
+	u32 Modes;
+	u32 Mode;
+	u32 Cycles = 0;
+
+	/*
+	 * Highest mode supported by the device that fits the SMC fields
+	 */
+	Modes = Param[ONFI_PARAM_TIMING_MODES] |
+			(Param[ONFI_PARAM_TIMING_MODES + 1] << 8);
+	for (Mode = ONFI_MAX_MODE; Mode > 0; Mode--) {
+		if ((Modes & (1 << Mode)) != 0) {
+			Cycles = NandSetCycles(&OnfiTimingMode[Mode]);
+			if (Cycles != 0) {
+				break;
+			}
+		}
+	}
+
+	if (Mode == 0) {
+		fsbl_printf(DEBUG_INFO,"InitNand: ONFI timing mode 0\r\n");
+		return;
+	}
+
+	NandCommand(ONFI_CMD_SET_FEATURES, 1, ONFI_FEATURE_TIMING);
+	Xil_Out32(FlashBase | NAND_DATA_PHASE | NAND_CLEAR_CS, Mode);
+	if (NandWaitReady() != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"InitNand: set features timeout\r\n");
+		return;
+	}
+
+	Xil_Out32(SmcBase + NAND_SMC_SET_CYCLES_OFFSET, Cycles);
+	Xil_Out32(SmcBase + NAND_SMC_DIRECT_CMD_OFFSET, NAND_SMC_UPDATE_REGS);
+
+	fsbl_printf(DEBUG_INFO,"InitNand: ONFI timing mode %d, cycles 0x%08x\r\n",
+			Mode, Cycles);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function converts an ONFI timing mode to the SMC set_cycles value at
+* NAND_SMC_CLK_HZ
+*
+* @param	Timing is the ONFI timing mode
+*
+* @return	set_cycles value, 0 if a time does not fit its field
+*
+* @note		None
+*
+******************************************************************************/
+static u32 NandSetCycles(const OnfiTiming *Timing)
+{
+	static const u8 Shift[] = {0, 4, 8, 11, 14, 17, 20};
+	static const u8 Max[] = {15, 15, 7, 7, 7, 7, 15};
+	u32 Ns[7];
+	u32 Cycles = 0;
+	u32 Count;
+	u32 Index;
+
+	Ns[0] = Timing->Trc;
+	Ns[1] = Timing->Twc;
+	Ns[2] = Timing->Trea;
+	Ns[3] = Timing->Twp;
+	Ns[4] = Timing->Tclr;
+	Ns[5] = Timing->Tar;
+	Ns[6] = Timing->Trr;
+
+	for (Index = 0; Index < 7; Index++) {
+		Count = ((Ns[Index] * NAND_SMC_CLK_MHZ) + 999) / 1000;
+		if (Count == 0) {
+			Count = 1;
+		}
+		if (Count > Max[Index]) {
+			return 0;
+		}
+		Cycles |= Count << Shift[Index];
+	}
+
+	return Cycles;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This function sends a command with its address cycles through the SMC
+* command phase
+*
+* @param	Command is the NAND command
+* @param	AddrCycles is the number of address cycles
+* @param	Address holds the address bytes, first cycle in bits 7:0
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+static void NandCommand(u32 Command, u32 AddrCycles, u32 Address)
+{
+	Xil_Out32(NandInstPtr->Config.FlashBase |
+			(AddrCycles << NAND_ADDR_CYCLES_SHIFT) |
+			(Command << NAND_START_CMD_SHIFT), Address);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends a READ PAGE for column 0 of a page
+*
+* @param	Page is the row address
+*
+* @return	None
+*
+* @note		Addresses of more than 4 cycles are sent with a second write.
+*
+******************************************************************************/
+static void NandCommandPage(u32 Page)
+{
+	u32 ColCycles = NandInstPtr->Geometry.ColAddrCycles;
+	u32 AddrCycles = ColCycles + NandInstPtr->Geometry.RowAddrCycles;
+	u32 CmdPhase = NandInstPtr->Config.FlashBase |
+			(AddrCycles << NAND_ADDR_CYCLES_SHIFT) | NAND_END_CMD_VALID |
+			(ONFI_CMD_READ_START << NAND_END_CMD_SHIFT) |
+			(ONFI_CMD_READ_MODE << NAND_START_CMD_SHIFT);
+
+	Xil_Out32(NandInstPtr->Config.SmcBase + NAND_SMC_CLR_CONFIG_OFFSET,
+			NAND_SMC_INT_CLR1);
+	Xil_Out32(CmdPhase, Page << (8 * ColCycles));
+	if (AddrCycles > 4) {
+		Xil_Out32(CmdPhase, Page >> (32 - (8 * ColCycles)));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits on the READ STATUS ready bit
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the device is ready
+*		- XST_FAILURE after FSBL_POLL_NAND_READY_US
+*
+* @note		The device is left in status mode, send ONFI_CMD_READ_MODE to
+*		read data.
+*
+******************************************************************************/
+static u32 NandWaitReady(void)
+{
+	u32 DataPhase = NandInstPtr->Config.FlashBase | NAND_DATA_PHASE;
+	PollDeadline Poll;
+	u32 Status = XST_SUCCESS;
+
+	NandCommand(ONFI_CMD_READ_STATUS, 0, 0);
+
+	PollStart(&Poll, POLL_SITE_NAND_READY);
+	while ((Xil_In8(DataPhase) & ONFI_STATUS_READY) == 0) {
+		if (PollExpired(&Poll)) {
+			Status = XST_FAILURE;
+			break;
+		}
+	}
+	PollEnd(&Poll);
+
+	(void)Xil_In8(DataPhase | NAND_CLEAR_CS);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits for the busy to ready edge of the NAND R/B line that
+* the SMC latches in its interrupt status, and clears it
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the device is ready
+*		- XST_FAILURE after FSBL_POLL_NAND_READY_US
+*
+* @note		The edge must have been cleared before the command.
+*
+******************************************************************************/
+static u32 NandWaitBusy(void)
+{
+	u32 SmcBase = NandInstPtr->Config.SmcBase;
+	PollDeadline Poll;
+	u32 Status = XST_SUCCESS;
+
+	PollStart(&Poll, POLL_SITE_NAND_READY);
+	while ((Xil_In32(SmcBase + NAND_SMC_STATUS_OFFSET) &
+			NAND_SMC_RAW_INT1) == 0) {
+		if (PollExpired(&Poll)) {
+			Status = XST_FAILURE;
+			break;
+		}
+	}
+	PollEnd(&Poll);
+
+	Xil_Out32(SmcBase + NAND_SMC_CLR_CONFIG_OFFSET, NAND_SMC_INT_CLR1);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the ONFI parameter page CRC
+*
+* @param	Buf is the parameter page
+* @param	Length is the number of bytes covered
+*
+* @return	CRC-16
+*
+* @note		None
+*
+******************************************************************************/
+static u16 OnfiCrc16(const u8 *Buf, u32 Length)
+{
+	u32 Crc = ONFI_CRC_INIT;
+	u32 Index;
+	u32 Bit;
+
+	for (Index = 0; Index < Length; Index++) {
+		Crc ^= (u32)Buf[Index] << 8;
+		for (Bit = 0; Bit < 8; Bit++) {
+			Crc = (Crc & 0x8000) ? ((Crc << 1) ^ ONFI_CRC_POLY) : (Crc << 1);
+		}
+	}
 
-	return ActLen;
+	return (u16)Crc;
 }
 
 #endif
@@ -44,6 +44,10 @@
 * 1.00a ecm	01/10/10 Initial release
 * 2.00a mb	30/05/12 added the flag XPAR_PS7_NAND_0_BASEADDR
 * 10.00a kc 08/04/14 Fix for CR#809336 - Removed smc.h
+* 12.00a hx 10/18/26 Added NAND_MAP_MAX_BLOCKS
+*                    Added NAND_SMC_CLK_HZ
+*                    Added NandSearchGeometry
+*                    Added NandAccessV
 * </pre>
 *
 * @note
@@ -64,10 +68,26 @@ extern "C" {
 
 #include "xnandps.h"
 #include "xnandps_bbm.h"
+#include "image_mover.h"
 /**************************** Type Definitions *******************************/
 
 /************************** Constant Definitions *****************************/
 
+/*
+ * Blocks covered by the bad block map built in InitNand, blocks above are
+ * looked up in the driver table. The map takes 3 bytes per 16 blocks.
+ */
+#ifndef NAND_MAP_MAX_BLOCKS
+#define NAND_MAP_MAX_BLOCKS		8192
+#endif
+
+/*
+ * NAND_SMC_CLK_HZ, the SMC clock, is not defined by default. When it is,
+ * usually as XPAR_PS7_NAND_0_NAND_CLK_FREQ_HZ, the NAND timing is raised to
+ * the fastest ONFI mode the device and this clock support. Without it the
+ * BootROM timing is kept.
+ */
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -78,6 +98,10 @@ u32 InitNand(void);
 u32 NandAccess( u32 SourceAddress,
                 u32 DestinationAddress,
                 u32 LengthWords);
+
+u32 NandAccessV(MoveSegment *Segments, u32 Count);
+
+void NandSearchGeometry(u32 *Size, u32 *Step);
 #endif
 /************************** Variable Definitions *****************************/
 
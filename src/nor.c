@@ -44,6 +44,10 @@
 * 1.00a ecm	01/10/10 Initial release
 * 2.00a mb	25/05/12 mio init removed
 * 3.00a sgd	30/01/13 Code cleanup
+* 12.00a hx	10/18/26 InitNor applies NOR_SMC_CYCLES/NOR_SMC_OPMODE, NorAccess
+*						uses the PCAP DMA or burst copies
+*						The DMAC copy service is used with FSBL_DMA_COPY
+*						Added NorAccessV
 *
 * </pre>
 *
@@ -55,8 +59,30 @@
 #include "fsbl.h"
 #include "nor.h"
 #include "xstatus.h"
+#include "fsbl_pmu.h"
+#include "pcap.h"
+#include "fsbl_dma.h"
+#include "xil_io.h"
 
 /************************** Constant Definitions *****************************/
+/*
+ * Gap in bytes NorAccessV reads through, the NOR is memory mapped so only
+ * the call overhead is saved
+ */
+#define NOR_MOVE_V_GAP		64
+
+/*
+ * SMC registers, the NOR is chip 0 of interface 0
+ */
+#define NOR_SMC_DIRECT_CMD_OFFSET	0x10
+#define NOR_SMC_SET_CYCLES_OFFSET	0x14
+#define NOR_SMC_SET_OPMODE_OFFSET	0x18
+#define NOR_SMC_UPDATE_REGS			(0x2 << 21)
+
+/*
+ * Words moved per burst by the CPU copy
+ */
+#define NOR_BURST_WORDS				8
 
 /**************************** Type Definitions *******************************/
 
@@ -64,6 +90,7 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static void NorCopy(u32 *DestAddr, u32 *SourceAddr, u32 LengthWords);
 
 /************************** Variable Definitions *****************************/
 
@@ -84,6 +111,22 @@ extern u32 FlashReadBaseAddress;
 ****************************************************************************/
 void InitNor(void)
 {
+#if defined(NOR_SMC_CYCLES) || defined(NOR_SMC_OPMODE)
+	/*
+	 * Boot ROM always initialize the nor at lower speed, move to the
+	 * timing of the part
+	 */
+#ifdef NOR_SMC_CYCLES
+	Xil_Out32(XPS_PARPORT_CRTL_BASEADDR + NOR_SMC_SET_CYCLES_OFFSET,
+			NOR_SMC_CYCLES);
+#endif
+#ifdef NOR_SMC_OPMODE
+	Xil_Out32(XPS_PARPORT_CRTL_BASEADDR + NOR_SMC_SET_OPMODE_OFFSET,
+			NOR_SMC_OPMODE);
+#endif
+	Xil_Out32(XPS_PARPORT_CRTL_BASEADDR + NOR_SMC_DIRECT_CMD_OFFSET,
+			NOR_SMC_UPDATE_REGS);
+#endif
 
 	/*
 	 * Set up the base address for access
@@ -105,17 +148,20 @@ void InitNor(void)
 *		- XST_SUCCESS if the write completes correctly
 *		- XST_FAILURE if the write fails to completes correctly
 *
-* @note		None.
+* @note		Large word aligned reads are moved by the DMAC with
+*		FSBL_DMA_COPY, by the PCAP DMA otherwise. The rest
+*		and a failed DMA fall back to the CPU copy.
 *
 ****************************************************************************/
 u32 NorAccess(u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 {
-	u32 Data;
-	u32 Count;
+	u32 Status;
 	u32 *SourceAddr;
 	u32 *DestAddr;
 	u32 LengthWords;
 
+	PMU_SCOPE_BEGIN(PMU_SCOPE_NOR_ACCESS);
+
 	/*
 	 * check for non-word tail
 	 * add bytes to cover the end
@@ -130,15 +176,87 @@ u32 NorAccess(u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 	SourceAddr = (u32 *)(SourceAddress + FlashReadBaseAddress);
 	DestAddr = (u32 *)(DestinationAddress);
 
-	/*
-	 * Word transfers, endianism isn't an issue
-	 */
-	for (Count=0; Count < LengthWords; Count++){
-
-		Data = Xil_In32((u32)(SourceAddr++));
-		Xil_Out32((u32)(DestAddr++), Data);
+	if ((LengthBytes >= NOR_DMA_MIN_BYTES) &&
+			((DestinationAddress & 0x3) == 0) &&
+			((SourceAddress & 0x3) == 0)) {
+#ifdef FSBL_DMA_COPY
+		Status = DmaCopyAsync((u32)SourceAddr, DestinationAddress,
+				LengthBytes);
+		if (Status == XST_SUCCESS) {
+			Status = DmaWait();
+		}
+#else
+		Status = PcapDataTransfer(SourceAddr, DestAddr,
+				LengthWords, LengthWords, 0);
+#endif
+		if (Status == XST_SUCCESS) {
+			PMU_SCOPE_END(PMU_SCOPE_NOR_ACCESS);
+			return XST_SUCCESS;
+		}
+		fsbl_printf(DEBUG_INFO,"NorAccess: DMA failed, CPU copy\r\n");
 	}
 
+	NorCopy(DestAddr, SourceAddr, LengthWords);
+
+	PMU_SCOPE_END(PMU_SCOPE_NOR_ACCESS);
+
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+*
+* This function is the vectored form of NorAccess, the segments are merged
+* into as few device reads as possible
+*
+* @param	Segments is the list of segments, it is sorted in place
+* @param	Count is the number of segments
+*
+* @return
+*		- XST_SUCCESS if all the segments were read
+*		- XST_FAILURE otherwise
+*
+* @note		None
+*
+****************************************************************************/
+u32 NorAccessV(MoveSegment *Segments, u32 Count)
+{
+	return MoveImageVector(Segments, Count, NorAccess, NOR_MOVE_V_GAP);
+}
+
+/******************************************************************************/
+/**
+*
+* This function copies words from the NOR window a burst at a time, each
+* burst is one LDM from the SMC and one STM to the destination.
+*
+* @param	DestAddr is the destination
+* @param	SourceAddr is the address in the NOR window
+* @param	LengthWords is the number of words
+*
+* @return	None
+*
+* @note		Word transfers, endianism isn't an issue. Unaligned addresses
+*		are copied a word at a time.
+*
+****************************************************************************/
+static void NorCopy(u32 *DestAddr, u32 *SourceAddr, u32 LengthWords)
+{
+	if ((((u32)DestAddr | (u32)SourceAddr) & 0x3) == 0) {
+		while (LengthWords >= NOR_BURST_WORDS) {
+			__asm__ __volatile__(
+				"ldmia %0!, {r3-r10}\n\t"
+				"stmia %1!, {r3-r10}"
+				: "+r" (SourceAddr), "+r" (DestAddr)
+				:
+				: "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10",
+				  "memory");
+			LengthWords -= NOR_BURST_WORDS;
+		}
+	}
+
+	while (LengthWords > 0) {
+		Xil_Out32((u32)(DestAddr++), Xil_In32((u32)(SourceAddr++)));
+		LengthWords--;
+	}
+}
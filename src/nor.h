@@ -43,6 +43,10 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00a ecm	01/10/10 Initial release
 * 10.00a kc 08/04/14 Fix for CR#809336 - Removed smc.h
+* 12.00a hx 10/18/26 Added NOR_SMC_CYCLES, NOR_SMC_OPMODE and
+*                    NOR_DMA_MIN_BYTES
+*                    NOR reads use the DMAC with FSBL_DMA_COPY
+*                    Added NorAccessV
 *
 * </pre>
 *
@@ -58,11 +62,31 @@ extern "C" {
 #endif
 
 /***************************** Include Files *********************************/
+#include "image_mover.h"
 
 /************************** Constant Definitions *****************************/
 
 #define XPS_NOR_BASEADDR 	XPS_PARPORT0_BASEADDR
 
+/*
+ * SMC SRAM/NOR timing applied by InitNor, the BootROM timing is kept when
+ * not defined. NOR_SMC_CYCLES is the set_cycles value: t_rc[3:0],
+ * t_wc[7:4], t_ceoe[10:8], t_wp[13:11], t_pc[16:14], t_tr[19:17].
+ * NOR_SMC_OPMODE is the set_opmode value, rd_bl[5:3] above 0 enables page
+ * reads of that burst length with t_pc as the page cycle. Keep mw[1:0] at
+ * 0, NOR boot is 8 bit.
+ */
+/* #define NOR_SMC_CYCLES */
+/* #define NOR_SMC_OPMODE */
+
+/*
+ * Word aligned reads of at least this many bytes go through the DMAC with
+ * FSBL_DMA_COPY, through the PCAP DMA otherwise
+ */
+#ifndef NOR_DMA_MIN_BYTES
+#define NOR_DMA_MIN_BYTES		4096
+#endif
+
 /**************************** Type Definitions *******************************/
 
 
@@ -77,6 +101,8 @@ u32 NorAccess( u32 SourceAddress,
 	       u32 DestinationAddress,
 	       u32 LengthBytes);
 
+u32 NorAccessV(MoveSegment *Segments, u32 Count);
+
 /************************** Variable Definitions *****************************/
 #ifdef __cplusplus
 }
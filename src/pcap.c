@@ -72,6 +72,9 @@
 * 8.00a kc  2/20/14		Fix for CR#775631 - FSBL: FsblGetGlobalTimer() 
 *						is not proper
 * 10.00a kc 07/24/14    Fix for CR#809336 - Minor code cleanup
+* 12.00a hx 10/18/26	Cache maintenance of the DMA buffers for
+*						FSBL_CACHED_LOAD
+*						XDcfgPollDone waits against a deadline per wait site
 * </pre>
 *
 * @note
@@ -88,6 +91,9 @@
 #include "xil_exception.h"
 #include "xdevcfg.h"
 #include "sleep.h"
+#include "fsbl_pmu.h"
+#include "fsbl_cache.h"
+#include "fsbl_poll.h"
 
 #ifdef XPAR_XWDTPS_0_BASEADDR
 #include "xwdtps.h"
@@ -106,7 +112,7 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
-extern int XDcfgPollDone(u32 MaskValue, u32 MaxCount);
+extern int XDcfgPollDone(u32 MaskValue, u32 Site);
 
 /************************** Variable Definitions *****************************/
 /* Devcfg driver instance */
@@ -171,6 +177,13 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	XWdtPs_RestartWdt(&Watchdog);
 #endif
 
+	/*
+	 * Write back the source and drop the destination lines before the DMA
+	 */
+	CacheCleanRange((u32)SourceDataPtr, SourceLength << WORD_LENGTH_SHIFT);
+	CacheCleanRange((u32)DestinationDataPtr,
+			DestinationLength << WORD_LENGTH_SHIFT);
+
 	/*
 	 * PCAP single DMA transfer setup
 	 */
@@ -197,13 +210,20 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	/*
 	 * Poll for the DMA done
 	 */
-	Status = XDcfgPollDone(XDCFG_IXR_DMA_DONE_MASK, MAX_COUNT);
+	Status = XDcfgPollDone(XDCFG_IXR_DMA_DONE_MASK,
+			POLL_SITE_DCFG_DMA_DONE);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_INFO,"PCAP_DMA_DONE_FAIL \r\n");
 		return XST_FAILURE;
 	}
 
 	fsbl_printf(DEBUG_INFO,"DMA Done ! \n\r");
+
+	/*
+	 * The DMA has written the destination behind the cache
+	 */
+	CacheInvalidateRange((u32)DestinationDataPtr & ~PCAP_LAST_TRANSFER,
+			DestinationLength << WORD_LENGTH_SHIFT);
 		
 	/*
 	 * Check for errors
@@ -292,6 +312,11 @@ u32 PcapLoadPartition(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	XWdtPs_RestartWdt(&Watchdog);
 #endif
 
+	/*
+	 * Write back the bitstream before the DMA reads it
+	 */
+	CacheCleanRange((u32)SourceDataPtr, SourceLength << WORD_LENGTH_SHIFT);
+
 	/*
 	 * PCAP single DMA transfer setup
 	 */
@@ -320,7 +345,8 @@ u32 PcapLoadPartition(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	/*
 	 * Poll for the DMA done
 	 */
-	Status = XDcfgPollDone(XDCFG_IXR_DMA_DONE_MASK, MAX_COUNT);
+	Status = XDcfgPollDone(XDCFG_IXR_DMA_DONE_MASK,
+			POLL_SITE_DCFG_DMA_DONE);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_INFO,"PCAP_DMA_DONE_FAIL \r\n");
 		return XST_FAILURE;
@@ -331,7 +357,8 @@ u32 PcapLoadPartition(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	/*
 	 * Poll for FPGA Done
 	 */
-	Status = XDcfgPollDone(XDCFG_IXR_PCFG_DONE_MASK, MAX_COUNT);
+	Status = XDcfgPollDone(XDCFG_IXR_PCFG_DONE_MASK,
+			POLL_SITE_DCFG_PCFG_DONE);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_INFO,"PCAP_FPGA_DONE_FAIL\r\n");
 		return XST_FAILURE;
@@ -643,7 +670,8 @@ void PcapDumpRegisters (void) {
 *
 * This function Polls for the DMA done or FPGA done.
 *
-* @param	none
+* @param	MaskValue is the interrupt status bits to wait for
+* @param	Site is the POLL_SITE_* wait site, it sets the timeout
 *
 * @return
 *		- XST_SUCCESS if polling for DMA/FPGA done is successful
@@ -652,11 +680,14 @@ void PcapDumpRegisters (void) {
 * @note		none
 *
 ****************************************************************************/
-int XDcfgPollDone(u32 MaskValue, u32 MaxCount)
+int XDcfgPollDone(u32 MaskValue, u32 Site)
 {
-	int Count = MaxCount;
+	PollDeadline Poll;
 	u32 IntrStsReg = 0;
 
+	PMU_SCOPE_BEGIN(PMU_SCOPE_DCFG_POLL_DONE);
+	PollStart(&Poll, Site);
+
 	/*
 	 * poll for the DMA done
 	 */
@@ -664,27 +695,29 @@ int XDcfgPollDone(u32 MaskValue, u32 MaxCount)
 	while ((IntrStsReg & MaskValue) !=
 				MaskValue) {
 		IntrStsReg = XDcfg_IntrGetStatus(DcfgInstPtr);
-		Count -=1;
 
 		if (IntrStsReg & FSBL_XDCFG_IXR_ERROR_FLAGS_MASK) {
 				fsbl_printf(DEBUG_INFO,"FATAL errors in PCAP %x\r\n",
 						IntrStsReg);
 				PcapDumpRegisters();
+				PollEnd(&Poll);
+				PMU_SCOPE_END(PMU_SCOPE_DCFG_POLL_DONE);
 				return XST_FAILURE;
 		}
 
-		if(!Count) {
+		if (PollExpired(&Poll)) {
 			fsbl_printf(DEBUG_GENERAL,"PCAP transfer timed out \r\n");
+			PollEnd(&Poll);
+			PMU_SCOPE_END(PMU_SCOPE_DCFG_POLL_DONE);
 			return XST_FAILURE;
 		}
-		if (Count > (MAX_COUNT-100)) {
-			fsbl_printf(DEBUG_GENERAL,".");
-		}
 	}
 
-	fsbl_printf(DEBUG_GENERAL,"\n\r");
+	PollEnd(&Poll);
 
 	XDcfg_IntrClear(DcfgInstPtr, IntrStsReg & MaskValue);
 
+	PMU_SCOPE_END(PMU_SCOPE_DCFG_POLL_DONE);
+
 	return XST_SUCCESS;
 }
@@ -44,6 +44,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00a ecm	02/10/10 Initial release
 * 2.00a mb  16/08/12 Added the macros and function prototypes
+* 12.00a hx 10/18/26 XDcfgPollDone takes a wait site instead of a count
 * </pre>
 *
 * @note
@@ -68,7 +69,6 @@ extern "C" {
 #define PCAP_CTRL_PCFG_AES_FUSE_EFUSE_MASK	0x1000
 
 #define PCAP_LAST_TRANSFER 1
-#define MAX_COUNT 1000000000
 #define LVL_PL_PS 0x0000000F
 #define LVL_PS_PL 0x0000000A
 
@@ -86,7 +86,7 @@ int InitPcap(void);
 void PcapDumpRegisters(void);
 u32 ClearPcapStatus(void);
 void FabricInit(void);
-int XDcfgPollDone(u32 MaskValue, u32 MaxCount);
+int XDcfgPollDone(u32 MaskValue, u32 Site);
 u32 PcapLoadPartition(u32 *SourceData, u32 *DestinationData, u32 SourceLength,
 		 	u32 DestinationLength, u32 Flags);
 u32 PcapDataTransfer(u32 *SourceData, u32 *DestinationData, u32 SourceLength,
@@ -35,7 +35,13 @@
 *****************************************************************************/
 
 #include "ps7_init.h"
+#include "ps7_init_gen.h"
 
+/*
+ * The tables are only built for the interpreted ps7_config() path, the
+ * default path runs the sequences compiled from them in ps7_init_gen.c
+ */
+#ifdef PS7_INIT_INTERPRETED
 unsigned long ps7_pll_init_data_3_0[] = {
     // START: top
     // .. START: SLCR SETTINGS
@@ -13058,10 +13064,27 @@ unsigned long ps7_debug_1_0[] = {
 
     //
 };
+#endif /* PS7_INIT_INTERPRETED */
+
 
 
 #include "xil_io.h"
-#define PS7_MASK_POLL_TIME 100000000
+#include "fsbl_poll.h"
+
+/* Polls on PLL_STATUS are the PLL lock waits, refer to fsbl_poll.h */
+#define PS7_POLL_SITE(addr) \
+    ((unsigned long)(addr) == 0xF800010C ? \
+        POLL_SITE_PS7_PLL_LOCK : POLL_SITE_PS7_MASKPOLL)
+
+#ifdef PS7_INIT_PRECOMPILED
+typedef const ps7_seq_t *ps7_table_t;
+#define PS7_TABLE(name)  (&name##_seq)
+#define PS7_RUN(table)   ps7_run(table)
+#else
+typedef unsigned long *ps7_table_t;
+#define PS7_TABLE(name)  (name)
+#define PS7_RUN(table)   ps7_config(table)
+#endif
 
 char*
 getPS7MessageInfo(unsigned key) {
@@ -13098,12 +13121,16 @@ void mask_write (unsigned long add , unsigned long  mask, unsigned long val ) {
 
 int mask_poll(unsigned long add , unsigned long mask ) {
         volatile unsigned long *addr = (volatile unsigned long*) add;
-        int i = 0;
+        PollDeadline poll;
+        PollStart(&poll, PS7_POLL_SITE(add));
         while (!(*addr & mask)) {
-          if (i == PS7_MASK_POLL_TIME) {
-            return -1;
+          if (PollExpired(&poll)) {
+            break;
           }
-          i++;
+        }
+        PollEnd(&poll);
+        if (poll.TimedOut) {
+            return -1;
         }
      return 1;   
         //xil_printf("MaskPoll : 0x%x --> 0x%x \n \r" , add, *addr);
@@ -13132,7 +13159,7 @@ ps7_config(unsigned long * ps7_config_init)
     unsigned long  val,mask;              // some variable to make code readable
 
     int finish = -1 ;           // loop while this is negative !
-    int i = 0;                  // Timeout variable
+    PollDeadline poll;          // Timeout
     
     while( finish < 0 ) {
         numargs = ptr[0] & 0xF;
@@ -13170,21 +13197,26 @@ ps7_config(unsigned long * ps7_config_init)
         case OPCODE_MASKPOLL:
             addr = (unsigned long*) args[0];
             mask = args[1];
-            i = 0;
+            PollStart(&poll, PS7_POLL_SITE(addr));
             while (!(*addr & mask)) {
-                if (i == PS7_MASK_POLL_TIME) {
+                if (PollExpired(&poll)) {
                     finish = PS7_INIT_TIMEOUT;
                     break;
                 }
-                i++;
             }
+            PollEnd(&poll);
             break;
         case OPCODE_MASKDELAY:
             addr = (unsigned long*) args[0];
             mask = args[1];
             int delay = get_number_of_cycles_for_delay(mask);
-            perf_reset_and_start_timer(); 
-            while ((*addr < delay)) {
+            /*
+             * Wait on the free running count rather than resetting the
+             * global timer, so the FSBL boot timeline stays monotonic
+             */
+            perf_start_clock();
+            val = *addr;
+            while ((*addr - val) < (unsigned long)delay) {
             }
             break;
         default:
@@ -13195,11 +13227,469 @@ ps7_config(unsigned long * ps7_config_init)
     return finish;
 }
 
-unsigned long *ps7_mio_init_data = ps7_mio_init_data_3_0;
-unsigned long *ps7_pll_init_data = ps7_pll_init_data_3_0;
-unsigned long *ps7_clock_init_data = ps7_clock_init_data_3_0;
-unsigned long *ps7_ddr_init_data = ps7_ddr_init_data_3_0;
-unsigned long *ps7_peripherals_init_data = ps7_peripherals_init_data_3_0;
+#ifdef PS7_INIT_PRECOMPILED
+/*
+ * Read position in a ps7_stream_t
+ */
+typedef struct {
+    const ps7_run_t *run;
+    const ps7_run_t *end;
+    unsigned long left;
+    const unsigned short *addr;
+    const unsigned char *mask;
+    const unsigned long *val;
+    unsigned long reg;
+} ps7_cursor_t;
+
+static void
+ps7_cursor_init(ps7_cursor_t *c, const ps7_stream_t *s)
+{
+    c->run = s->runs;
+    c->end = s->runs + s->nruns;
+    c->left = s->nruns ? s->runs->count : 0;
+    c->addr = s->addr;
+    c->mask = s->mask;
+    c->val = s->val;
+    c->reg = PS7_ADDR_ORIGIN;
+}
+
+static unsigned long
+ps7_next_addr(ps7_cursor_t *c)
+{
+    unsigned long d = *c->addr++;
+
+    if (d == PS7_ADDR_FAR) {
+        c->reg = ((unsigned long)c->addr[0] << 16) | c->addr[1];
+        c->addr += 2;
+    } else {
+        c->reg += (unsigned long)(long)(short)d;
+    }
+    return c->reg;
+}
+
+/*
+ * Runs the next n entries of a stream, or only steps over them when run
+ * is 0. Each run is a tight loop over the packed arrays, refer to
+ * ps7_init_gen.h
+ */
+static int
+ps7_stream(ps7_cursor_t *c, unsigned long n, int run)
+{
+    const unsigned long *masks = ps7_masks;
+    volatile unsigned long *reg;
+    unsigned long k;
+    unsigned long start;
+    unsigned long delay;
+    PollDeadline poll;
+
+    while (n && c->run < c->end) {
+        k = (n < c->left) ? n : c->left;
+        n -= k;
+        c->left -= k;
+
+        if (!run) {
+            for (start = 0; start < k; start++) {
+                ps7_next_addr(c);
+            }
+            switch (c->run->op) {
+            case PS7_RUN_WRITE:
+                c->val += k;
+                break;
+            case PS7_RUN_MASKWRITE:
+                c->val += k;
+                c->mask += k;
+                break;
+            default:
+                c->mask += k;
+                break;
+            }
+            k = 0;
+        }
+
+        switch (c->run->op) {
+
+        case PS7_RUN_WRITE:
+            while (k--) {
+                *(volatile unsigned long *)ps7_next_addr(c) = *c->val++;
+            }
+            break;
+
+        case PS7_RUN_MASKWRITE:
+            while (k--) {
+                reg = (volatile unsigned long *)ps7_next_addr(c);
+                *reg = (*reg & ~masks[*c->mask++]) | *c->val++;
+            }
+            break;
+
+        case PS7_RUN_MASKPOLL:
+            while (k--) {
+                reg = (volatile unsigned long *)ps7_next_addr(c);
+                PollStart(&poll, PS7_POLL_SITE(reg));
+                while (!(*reg & masks[*c->mask])) {
+                    if (PollExpired(&poll)) {
+                        break;
+                    }
+                }
+                PollEnd(&poll);
+                if (poll.TimedOut) {
+                    return PS7_INIT_TIMEOUT;
+                }
+                c->mask++;
+            }
+            break;
+
+        case PS7_RUN_MASKPOLL_ALL:
+            while (k--) {
+                reg = (volatile unsigned long *)ps7_next_addr(c);
+                PollStart(&poll, PS7_POLL_SITE(reg));
+                while ((*reg & masks[*c->mask]) != masks[*c->mask]) {
+                    if (PollExpired(&poll)) {
+                        break;
+                    }
+                }
+                PollEnd(&poll);
+                if (poll.TimedOut) {
+                    return PS7_INIT_TIMEOUT;
+                }
+                c->mask++;
+            }
+            break;
+
+        case PS7_RUN_MASKDELAY:
+            while (k--) {
+                reg = (volatile unsigned long *)ps7_next_addr(c);
+                delay = get_number_of_cycles_for_delay(masks[*c->mask++]);
+                perf_start_clock();
+                start = *reg;
+                while ((*reg - start) < delay) {
+                }
+            }
+            break;
+
+        default:
+            return PS7_INIT_CORRUPT;
+        }
+
+        if (c->left == 0 && ++c->run < c->end) {
+            c->left = c->run->count;
+        }
+    }
+    return PS7_INIT_SUCCESS;
+}
+
+/*
+ * Runs the base stream of a sequence with its delta patches applied on
+ * the way
+ */
+int
+ps7_run(const ps7_seq_t *seq)
+{
+    const ps7_delta_t *d = seq->delta;
+    const ps7_delta_t *end = d + seq->ndelta;
+    ps7_cursor_t base;
+    ps7_cursor_t patch;
+    unsigned long pos = 0;
+    int ret;
+
+    ps7_cursor_init(&base, seq->base);
+    if (seq->patch) {
+        ps7_cursor_init(&patch, seq->patch);
+    }
+
+    for ( ; d < end; d++) {
+        ret = ps7_stream(&base, d->at - pos, 1);
+        if (ret != PS7_INIT_SUCCESS) {
+            return ret;
+        }
+        ps7_stream(&base, d->skip, 0);
+        ret = ps7_stream(&patch, d->count, 1);
+        if (ret != PS7_INIT_SUCCESS) {
+            return ret;
+        }
+        pos = d->at + d->skip;
+    }
+    return ps7_stream(&base, ~0UL, 1);
+}
+#endif
+
+#ifdef PS7_WARM_RESET_FAST
+#define PS7_RESET_REASON        0xF8000250
+#define PS7_REBOOT_STATUS       0xF8000258
+#define PS7_REBOOT_REASON_SHIFT 16
+#define PS7_REBOOT_REASON_MASK  0x000000FF
+#define PS7_RESET_REASON_POR    0x00000040
+#define PS7_PLL_STATUS          0xF800010C
+#define PS7_PLL_LOCKED          0x00000007
+#define PS7_DDRC_MODE_STS       0xF8006054
+#define PS7_DDRC_MODE_MASK      0x00000007
+#define PS7_DDRC_MODE_NORMAL    0x00000001
+
+unsigned long ps7_warm_boot = 0;
+
+/*
+ * Folds the fingerprinted register bits, tools/ps7_compile.py computes
+ * the expected value the same way
+ */
+static unsigned long
+ps7_fingerprint(const ps7_fp_t *fp)
+{
+    unsigned long sum = 0;
+    unsigned long i;
+
+    for (i = 0; i < fp->count; i++) {
+        sum = ((sum << 1) | (sum >> 31)) ^
+            (*(volatile unsigned long *)fp->addr[i] & fp->mask[i]);
+    }
+    return sum;
+}
+
+/*
+ * Returns 1 when the reset left the PLLs and DDR running with the
+ * configuration the tables would set up again. From silicon 2.0 the
+ * BootROM clears RESET_REASON and keeps the reason in REBOOT_STATUS[23:16]
+ */
+static int
+ps7_warm_configured(const ps7_fp_t *fp, unsigned long si_ver)
+{
+    unsigned long reason;
+
+    if (si_ver == PCW_SILICON_VERSION_1) {
+        reason = *(volatile unsigned long *)PS7_RESET_REASON;
+    } else {
+        reason = (*(volatile unsigned long *)PS7_REBOOT_STATUS >>
+            PS7_REBOOT_REASON_SHIFT) & PS7_REBOOT_REASON_MASK;
+    }
+
+    if (fp == 0 || reason == 0 || (reason & PS7_RESET_REASON_POR)) {
+        return 0;
+    }
+    if ((*(volatile unsigned long *)PS7_PLL_STATUS & PS7_PLL_LOCKED) !=
+            PS7_PLL_LOCKED) {
+        return 0;
+    }
+    if ((*(volatile unsigned long *)PS7_DDRC_MODE_STS & PS7_DDRC_MODE_MASK) !=
+            PS7_DDRC_MODE_NORMAL) {
+        return 0;
+    }
+    return ps7_fingerprint(fp) == fp->sum;
+}
+#endif
+
+ps7_table_t ps7_mio_init_data = PS7_TABLE(ps7_mio_init_data_3_0);
+ps7_table_t ps7_pll_init_data = PS7_TABLE(ps7_pll_init_data_3_0);
+ps7_table_t ps7_clock_init_data = PS7_TABLE(ps7_clock_init_data_3_0);
+ps7_table_t ps7_ddr_init_data = PS7_TABLE(ps7_ddr_init_data_3_0);
+ps7_table_t ps7_peripherals_init_data = PS7_TABLE(ps7_peripherals_init_data_3_0);
+
+#ifdef PS7_DDR_TRAIN_CACHE
+#define PS7_BOOT_MODE           0xF800025C
+#define PS7_BOOT_MODE_MASK      0x00000007
+#define PS7_BOOT_MODE_QSPI      0x00000001
+#define PS7_LQSPI_CR            0xE000D0A0
+#define PS7_LQSPI_CR_LINEAR     0x80000000
+#define PS7_LQSPI_BASE          0xFC000000
+
+#define PS7_PHY_RD_DQS_CFG(n)   (0xF8006140 + ((n) << 2))
+#define PS7_PHY_WR_DQS_CFG(n)   (0xF8006154 + ((n) << 2))
+#define PS7_PHY_WE_CFG(n)       (0xF8006168 + ((n) << 2))
+#define PS7_PHY_WR_DATA_SLV(n)  (0xF800617C + ((n) << 2))
+#define PS7_PHY_REG_65          0xF8006194
+#define PS7_PHY_USE_LEVELING    0x0001C000  /* wr level, gate, data eye */
+#define PS7_PHY_REG6E_71X(n)    (0xF80061B8 + ((n) << 2))
+#define PS7_PHY_RATIO_MASK      0x000003FF
+#define PS7_PHY_WE_RATIO_MASK   0x000007FF
+
+/* Trained ratios in reg6e_71x, the record keeps the same layout */
+#define PS7_TRAIN_RD_DQS(r)     ((r) & 0x3FF)
+#define PS7_TRAIN_GATE(r)       (((r) >> 10) & 0x7FF)
+#define PS7_TRAIN_WR_DQS(r)     (((r) >> 21) & 0x3FF)
+
+unsigned long ps7_ddr_trained = 0;
+
+static const ps7_seq_t *ps7_ddr_cfg;
+static const ps7_seq_t *ps7_ddr_start;
+static unsigned long ps7_ddr_config;
+static ps7_ddr_train_t ps7_ddr_record;
+
+static unsigned long
+ps7_ddr_train_sum(const ps7_ddr_train_t *rec)
+{
+    const unsigned long *word = (const unsigned long *)rec;
+    unsigned long sum = 0;
+    unsigned long i;
+
+    for (i = 0; i < (sizeof(*rec) / sizeof(*word)) - 1; i++) {
+        sum += word[i];
+    }
+    return ~sum;
+}
+
+static int
+ps7_ddr_train_valid(const ps7_ddr_train_t *rec)
+{
+    unsigned long i;
+
+    if (rec->magic != PS7_DDR_TRAIN_MAGIC ||
+        rec->version != PS7_DDR_TRAIN_VERSION ||
+        rec->config != ps7_ddr_config ||
+        rec->checksum != ps7_ddr_train_sum(rec)) {
+        return 0;
+    }
+    for (i = 0; i < PS7_DDR_TRAIN_SLICES; i++) {
+        if (PS7_TRAIN_RD_DQS(rec->result[i]) == 0 ||
+            PS7_TRAIN_GATE(rec->result[i]) == 0 ||
+            PS7_TRAIN_WR_DQS(rec->result[i]) == 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Looks for a record in OCM (kept over resets) and then in the boot
+ * flash through the linear QSPI window left on by the BootROM
+ */
+static const ps7_ddr_train_t *
+ps7_ddr_train_find(void)
+{
+    const ps7_ddr_train_t *rec = (const ps7_ddr_train_t *)PS7_DDR_TRAIN_ADDR;
+
+    if (ps7_ddr_train_valid(rec)) {
+        return rec;
+    }
+#ifdef PS7_DDR_TRAIN_FLASH_OFFSET
+    if ((*(volatile unsigned long *)PS7_BOOT_MODE & PS7_BOOT_MODE_MASK) ==
+            PS7_BOOT_MODE_QSPI &&
+        (*(volatile unsigned long *)PS7_LQSPI_CR & PS7_LQSPI_CR_LINEAR)) {
+        rec = (const ps7_ddr_train_t *)
+            (PS7_LQSPI_BASE + PS7_DDR_TRAIN_FLASH_OFFSET);
+        if (ps7_ddr_train_valid(rec)) {
+            return rec;
+        }
+    }
+#endif
+    return 0;
+}
+
+/*
+ * Checks the recorded ratios against the ones the PCW programmed with the
+ * DDR configuration, a record further than PS7_DDR_TRAIN_WINDOW from them
+ * is not used
+ */
+static int
+ps7_ddr_train_in_window(const ps7_ddr_train_t *rec)
+{
+    unsigned long i;
+    long rd, gate, wr;
+
+    for (i = 0; i < PS7_DDR_TRAIN_SLICES; i++) {
+        rd = (long)PS7_TRAIN_RD_DQS(rec->result[i]) -
+            (long)mask_read(PS7_PHY_RD_DQS_CFG(i), PS7_PHY_RATIO_MASK);
+        gate = (long)PS7_TRAIN_GATE(rec->result[i]) -
+            (long)mask_read(PS7_PHY_WE_CFG(i), PS7_PHY_WE_RATIO_MASK);
+        wr = (long)PS7_TRAIN_WR_DQS(rec->result[i]) -
+            (long)mask_read(PS7_PHY_WR_DQS_CFG(i), PS7_PHY_RATIO_MASK);
+        if (rd > PS7_DDR_TRAIN_WINDOW || rd < -PS7_DDR_TRAIN_WINDOW ||
+            gate > PS7_DDR_TRAIN_WINDOW || gate < -PS7_DDR_TRAIN_WINDOW ||
+            wr > PS7_DDR_TRAIN_WINDOW || wr < -PS7_DDR_TRAIN_WINDOW) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Programs the recorded ratios as PHY slave ratios and turns the training
+ * off. The write data ratio keeps the offset to the write DQS ratio the
+ * PCW set up.
+ */
+static void
+ps7_ddr_train_apply(const ps7_ddr_train_t *rec)
+{
+    unsigned long i;
+    unsigned long wr;
+    unsigned long offset;
+
+    for (i = 0; i < PS7_DDR_TRAIN_SLICES; i++) {
+        wr = PS7_TRAIN_WR_DQS(rec->result[i]);
+        offset = mask_read(PS7_PHY_WR_DATA_SLV(i), PS7_PHY_RATIO_MASK) -
+            mask_read(PS7_PHY_WR_DQS_CFG(i), PS7_PHY_RATIO_MASK);
+        mask_write(PS7_PHY_RD_DQS_CFG(i), PS7_PHY_RATIO_MASK,
+            PS7_TRAIN_RD_DQS(rec->result[i]));
+        mask_write(PS7_PHY_WE_CFG(i), PS7_PHY_WE_RATIO_MASK,
+            PS7_TRAIN_GATE(rec->result[i]));
+        mask_write(PS7_PHY_WR_DQS_CFG(i), PS7_PHY_RATIO_MASK, wr);
+        mask_write(PS7_PHY_WR_DATA_SLV(i), PS7_PHY_RATIO_MASK, wr + offset);
+    }
+    mask_write(PS7_PHY_REG_65, PS7_PHY_USE_LEVELING, 0);
+}
+
+/*
+ * DDR init from a training record when there is a valid one close to the
+ * PCW ratios, the full DDR sequence with training otherwise
+ */
+static int
+ps7_ddr_init_cached(void)
+{
+    const ps7_ddr_train_t *rec = ps7_ddr_train_find();
+    int ret;
+
+    if (rec == 0) {
+        ps7_ddr_trained = 0;
+        return PS7_RUN (ps7_ddr_init_data);
+    }
+
+    ps7_ddr_record = *rec;
+    ret = PS7_RUN (ps7_ddr_cfg);
+    if (ret != PS7_INIT_SUCCESS) return ret;
+
+    /* The start sequence trains when the ratios are left as they are */
+    if (!ps7_ddr_train_in_window(&ps7_ddr_record)) {
+        ps7_ddr_trained = 0;
+        return PS7_RUN (ps7_ddr_start);
+    }
+
+    ps7_ddr_train_apply(&ps7_ddr_record);
+    ps7_ddr_trained = 1;
+
+    return PS7_RUN (ps7_ddr_start);
+}
+
+/*
+ * Called by the FSBL once DDR passed its memory test, leaves the record in
+ * OCM for the next reset and for the FSBL to store in the boot flash
+ */
+void
+ps7_ddr_train_commit(void)
+{
+    ps7_ddr_train_t *ocm = (ps7_ddr_train_t *)PS7_DDR_TRAIN_ADDR;
+    unsigned long i;
+
+    if (!ps7_ddr_trained) {
+        ps7_ddr_record.magic = PS7_DDR_TRAIN_MAGIC;
+        ps7_ddr_record.version = PS7_DDR_TRAIN_VERSION;
+        ps7_ddr_record.config = ps7_ddr_config;
+        for (i = 0; i < PS7_DDR_TRAIN_SLICES; i++) {
+            ps7_ddr_record.result[i] =
+                *(volatile unsigned long *)PS7_PHY_REG6E_71X(i);
+        }
+        ps7_ddr_record.checksum = ps7_ddr_train_sum(&ps7_ddr_record);
+    }
+    *ocm = ps7_ddr_record;
+}
+
+/*
+ * Called by the FSBL when DDR set up from a record failed its memory test
+ */
+int
+ps7_ddr_retrain(void)
+{
+    ((ps7_ddr_train_t *)PS7_DDR_TRAIN_ADDR)->magic = 0;
+    ps7_ddr_trained = 0;
+
+    return PS7_RUN (ps7_ddr_init_data);
+}
+#endif
 
 int
 ps7_post_config() 
@@ -13208,13 +13698,13 @@ ps7_post_config()
   unsigned long si_ver = ps7GetSiliconVersion ();
   int ret = -1;
   if (si_ver == PCW_SILICON_VERSION_1) {
-      ret = ps7_config (ps7_post_config_1_0);   
+      ret = PS7_RUN (PS7_TABLE(ps7_post_config_1_0));
       if (ret != PS7_INIT_SUCCESS) return ret;
   } else if (si_ver == PCW_SILICON_VERSION_2) {
-      ret = ps7_config (ps7_post_config_2_0);   
+      ret = PS7_RUN (PS7_TABLE(ps7_post_config_2_0));
       if (ret != PS7_INIT_SUCCESS) return ret;
   } else {
-      ret = ps7_config (ps7_post_config_3_0);
+      ret = PS7_RUN (PS7_TABLE(ps7_post_config_3_0));
       if (ret != PS7_INIT_SUCCESS) return ret;
   }
   return PS7_INIT_SUCCESS;
@@ -13227,13 +13717,13 @@ ps7_debug()
   unsigned long si_ver = ps7GetSiliconVersion ();
   int ret = -1;
   if (si_ver == PCW_SILICON_VERSION_1) {
-      ret = ps7_config (ps7_debug_1_0);   
+      ret = PS7_RUN (PS7_TABLE(ps7_debug_1_0));
       if (ret != PS7_INIT_SUCCESS) return ret;
   } else if (si_ver == PCW_SILICON_VERSION_2) {
-      ret = ps7_config (ps7_debug_2_0);   
+      ret = PS7_RUN (PS7_TABLE(ps7_debug_2_0));
       if (ret != PS7_INIT_SUCCESS) return ret;
   } else {
-      ret = ps7_config (ps7_debug_3_0);
+      ret = PS7_RUN (PS7_TABLE(ps7_debug_3_0));
       if (ret != PS7_INIT_SUCCESS) return ret;
   }
   return PS7_INIT_SUCCESS;
@@ -13246,52 +13736,114 @@ ps7_init()
   unsigned long si_ver = ps7GetSiliconVersion ();
   int ret;
   //int pcw_ver = 0;
+#ifdef PS7_WARM_RESET_FAST
+  const ps7_fp_t *warm_fp = 0;
+  const ps7_seq_t *warm_mio = 0;
+#endif
 
   if (si_ver == PCW_SILICON_VERSION_1) {
-    ps7_mio_init_data = ps7_mio_init_data_1_0;
-    ps7_pll_init_data = ps7_pll_init_data_1_0;
-    ps7_clock_init_data = ps7_clock_init_data_1_0;
-    ps7_ddr_init_data = ps7_ddr_init_data_1_0;
-    ps7_peripherals_init_data = ps7_peripherals_init_data_1_0;
+    ps7_mio_init_data = PS7_TABLE(ps7_mio_init_data_1_0);
+    ps7_pll_init_data = PS7_TABLE(ps7_pll_init_data_1_0);
+    ps7_clock_init_data = PS7_TABLE(ps7_clock_init_data_1_0);
+    ps7_ddr_init_data = PS7_TABLE(ps7_ddr_init_data_1_0);
+    ps7_peripherals_init_data = PS7_TABLE(ps7_peripherals_init_data_1_0);
+#ifdef PS7_DDR_TRAIN_CACHE
+    ps7_ddr_cfg = &ps7_ddr_init_data_1_0_cfg_seq;
+    ps7_ddr_start = &ps7_ddr_init_data_1_0_start_seq;
+    ps7_ddr_config = ps7_warm_fp_1_0.sum;
+#endif
+#ifdef PS7_WARM_RESET_FAST
+    warm_fp = &ps7_warm_fp_1_0;
+    warm_mio = &ps7_mio_init_data_1_0_warm_seq;
+#endif
     //pcw_ver = 1;
 
   } else if (si_ver == PCW_SILICON_VERSION_2) {
-    ps7_mio_init_data = ps7_mio_init_data_2_0;
-    ps7_pll_init_data = ps7_pll_init_data_2_0;
-    ps7_clock_init_data = ps7_clock_init_data_2_0;
-    ps7_ddr_init_data = ps7_ddr_init_data_2_0;
-    ps7_peripherals_init_data = ps7_peripherals_init_data_2_0;
+    ps7_mio_init_data = PS7_TABLE(ps7_mio_init_data_2_0);
+    ps7_pll_init_data = PS7_TABLE(ps7_pll_init_data_2_0);
+    ps7_clock_init_data = PS7_TABLE(ps7_clock_init_data_2_0);
+    ps7_ddr_init_data = PS7_TABLE(ps7_ddr_init_data_2_0);
+    ps7_peripherals_init_data = PS7_TABLE(ps7_peripherals_init_data_2_0);
+#ifdef PS7_DDR_TRAIN_CACHE
+    ps7_ddr_cfg = &ps7_ddr_init_data_2_0_cfg_seq;
+    ps7_ddr_start = &ps7_ddr_init_data_2_0_start_seq;
+    ps7_ddr_config = ps7_warm_fp_2_0.sum;
+#endif
+#ifdef PS7_WARM_RESET_FAST
+    warm_fp = &ps7_warm_fp_2_0;
+    warm_mio = &ps7_mio_init_data_2_0_warm_seq;
+#endif
     //pcw_ver = 2;
 
   } else {
-    ps7_mio_init_data = ps7_mio_init_data_3_0;
-    ps7_pll_init_data = ps7_pll_init_data_3_0;
-    ps7_clock_init_data = ps7_clock_init_data_3_0;
-    ps7_ddr_init_data = ps7_ddr_init_data_3_0;
-    ps7_peripherals_init_data = ps7_peripherals_init_data_3_0;
+    ps7_mio_init_data = PS7_TABLE(ps7_mio_init_data_3_0);
+    ps7_pll_init_data = PS7_TABLE(ps7_pll_init_data_3_0);
+    ps7_clock_init_data = PS7_TABLE(ps7_clock_init_data_3_0);
+    ps7_ddr_init_data = PS7_TABLE(ps7_ddr_init_data_3_0);
+    ps7_peripherals_init_data = PS7_TABLE(ps7_peripherals_init_data_3_0);
+#ifdef PS7_DDR_TRAIN_CACHE
+    ps7_ddr_cfg = &ps7_ddr_init_data_3_0_cfg_seq;
+    ps7_ddr_start = &ps7_ddr_init_data_3_0_start_seq;
+    ps7_ddr_config = ps7_warm_fp_3_0.sum;
+#endif
+#ifdef PS7_WARM_RESET_FAST
+    warm_fp = &ps7_warm_fp_3_0;
+    warm_mio = &ps7_mio_init_data_3_0_warm_seq;
+#endif
     //pcw_ver = 3;
   }
 
+#ifdef PS7_WARM_RESET_FAST
+  // Warm reset with PLLs and DDR still configured, redo the rest only
+  if (ps7_warm_configured(warm_fp, si_ver)) {
+    ps7_warm_boot = 1;
+#ifdef PS7_DDR_TRAIN_CACHE
+    // DDR keeps running with whatever the last boot programmed
+    {
+      const ps7_ddr_train_t *rec = ps7_ddr_train_find();
+      if (rec != 0) {
+        ps7_ddr_record = *rec;
+        ps7_ddr_trained = 1;
+      }
+    }
+#endif
+
+    ret = PS7_RUN (warm_mio);
+    if (ret != PS7_INIT_SUCCESS) return ret;
+
+    ret = PS7_RUN (ps7_clock_init_data);
+    if (ret != PS7_INIT_SUCCESS) return ret;
+
+    ret = PS7_RUN (ps7_peripherals_init_data);
+    if (ret != PS7_INIT_SUCCESS) return ret;
+    return PS7_INIT_SUCCESS;
+  }
+#endif
+
   // MIO init
-  ret = ps7_config (ps7_mio_init_data);  
+  ret = PS7_RUN (ps7_mio_init_data);  
   if (ret != PS7_INIT_SUCCESS) return ret;
 
   // PLL init
-  ret = ps7_config (ps7_pll_init_data); 
+  ret = PS7_RUN (ps7_pll_init_data); 
   if (ret != PS7_INIT_SUCCESS) return ret;
 
   // Clock init
-  ret = ps7_config (ps7_clock_init_data);
+  ret = PS7_RUN (ps7_clock_init_data);
   if (ret != PS7_INIT_SUCCESS) return ret;
 
   // DDR init
-  ret = ps7_config (ps7_ddr_init_data);
+#ifdef PS7_DDR_TRAIN_CACHE
+  ret = ps7_ddr_init_cached();
+#else
+  ret = PS7_RUN (ps7_ddr_init_data);
+#endif
   if (ret != PS7_INIT_SUCCESS) return ret;
 
 
 
   // Peripherals init
-  ret = ps7_config (ps7_peripherals_init_data);
+  ret = PS7_RUN (ps7_peripherals_init_data);
   if (ret != PS7_INIT_SUCCESS) return ret;
   //xil_printf ("\n PCW Silicon Version : %d.0", pcw_ver);
   return PS7_INIT_SUCCESS;
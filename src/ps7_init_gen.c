@@ -0,0 +1,1038 @@
+/******************************************************************************
+*
+* (c) Copyright 2010-2014 Xilinx, Inc. All rights reserved.
+*
+* Generated by tools/ps7_compile.py from ps7_init.c, do not edit.
+* Refer to ps7_init_gen.h for the sequence format.
+*
+* Sequences: 3102 bytes, 8972 bytes as separate tables.
+*
+******************************************************************************/
+
+#include "ps7_init_gen.h"
+
+#ifdef PS7_INIT_PRECOMPILED
+
+const unsigned long ps7_masks[] = {
+    0x0000FFFFU, 0x003FFFF0U, 0x0007F000U, 0x00000010U,
+    0x00000001U, 0x00000007U, 0x1F003F30U, 0xFFF00003U,
+    0x03F03F01U, 0x00000011U, 0x03F03F71U, 0x00003F31U,
+    0x00003F33U, 0x03F03F30U, 0x01FFCCCDU, 0x0001FFFFU,
+    0x0007FFFFU, 0x03FFFFFFU, 0x001FFFFFU, 0xF7FFFFFFU,
+    0x7FDFFFFCU, 0x0FFFFFC3U, 0x00003FFFU, 0x13FF3FFFU,
+    0x00000003U, 0x000FFFFFU, 0x0FFFFFFFU, 0x0003F03FU,
+    0xFF0F8FFFU, 0x00010000U, 0x000017FFU, 0x00021FE0U,
+    0x000001FFU, 0x1FFFFFFFU, 0x00000200U, 0x01FFFFFFU,
+    0x000000FFU, 0x0000000FU, 0x7FFFFFCFU, 0x6FFFFEFEU,
+    0x000703FFU, 0x000F03FFU, 0x00000FF5U, 0x003FFFFFU,
+    0x0003FFFFU, 0x00002000U, 0x00000FFFU, 0x00007FFFU,
+    0x00000021U, 0x07FEFFFFU, 0x00000180U, 0x000003FFU,
+    0x00080000U, 0x20000000U, 0xFFFFFFFCU, 0x00001FC3U,
+    0x3FFFFFFFU, 0x00FFFFFFU, 0x000007FFU, 0x7FFFFFFFU,
+    0x00000FF7U, 0x07FFFFFFU, 0x000073FFU,
+};
+
+/* ps7_pll_init_data_stream: 23 entries in 3 runs, 189 bytes */
+static const ps7_run_t ps7_pll_init_data_stream_runs[] = {
+    { PS7_RUN_MASKWRITE, 16 }, { PS7_RUN_MASKPOLL_ALL, 1 }, { PS7_RUN_MASKWRITE, 6 },
+};
+static const unsigned short ps7_pll_init_data_stream_addr[] = {
+    0x0008, 0x0108, 0xFFF0, 0x0000,
+    0x0000, 0x0014, 0xFFF0, 0x0000,
+    0x0000, 0x0014, 0xFFF0, 0x0000,
+    0x0000, 0xFFF8, 0x0004, 0x0004,
+    0x0004, 0xFFF4, 0x0020, 0xFFE4,
+    0x0020, 0xFFE4, 0xFEFC,
+};
+static const unsigned char ps7_pll_init_data_stream_mask[] = {
+    0, 1, 2, 3,
+    4, 1, 2, 3,
+    4, 1, 2, 3,
+    4, 4, 4, 4,
+    5, 3, 6, 3,
+    7, 3, 0,
+};
+static const unsigned long ps7_pll_init_data_stream_val[] = {
+    0x0000DF0DU, 0x001772C0U, 0x0001A000U, 0x00000010U,
+    0x00000001U, 0x001DB2C0U, 0x00015000U, 0x00000010U,
+    0x00000001U, 0x001F42C0U, 0x00014000U, 0x00000010U,
+    0x00000001U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x1F000200U, 0x00000000U, 0x0C200003U,
+    0x00000000U, 0x0000767BU,
+};
+static const ps7_stream_t ps7_pll_init_data_stream = {
+    ps7_pll_init_data_stream_runs,
+    3,
+    ps7_pll_init_data_stream_addr,
+    ps7_pll_init_data_stream_mask,
+    ps7_pll_init_data_stream_val,
+};
+
+const ps7_seq_t ps7_pll_init_data_3_0_seq = {
+    &ps7_pll_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_clock_init_data_stream: 18 entries in 1 runs, 150 bytes */
+static const ps7_run_t ps7_clock_init_data_stream_runs[] = {
+    { PS7_RUN_MASKWRITE, 18 },
+};
+static const unsigned short ps7_clock_init_data_stream_addr[] = {
+    0x0008, 0x0120, 0x0010, 0x0004,
+    0x0004, 0x0004, 0x0008, 0x0008,
+    0x0004, 0x0010, 0x0008, 0x0010,
+    0x0010, 0x0010, 0x0024, 0xFF68,
+    0x01D8, 0xFD00,
+};
+static const unsigned char ps7_clock_init_data_stream_mask[] = {
+    0, 8, 9, 9,
+    10, 10, 11, 12,
+    12, 11, 13, 13,
+    13, 13, 4, 14,
+    4, 0,
+};
+static const unsigned long ps7_clock_init_data_stream_val[] = {
+    0x0000DF0DU, 0x00203401U, 0x00000001U, 0x00000011U,
+    0x00100801U, 0x00100141U, 0x00000501U, 0x00000A03U,
+    0x00000603U, 0x00000501U, 0x00101400U, 0x00100800U,
+    0x00101400U, 0x00101400U, 0x00000001U, 0x01FCC0CDU,
+    0x00000000U, 0x0000767BU,
+};
+static const ps7_stream_t ps7_clock_init_data_stream = {
+    ps7_clock_init_data_stream_runs,
+    1,
+    ps7_clock_init_data_stream_addr,
+    ps7_clock_init_data_stream_mask,
+    ps7_clock_init_data_stream_val,
+};
+
+const ps7_seq_t ps7_clock_init_data_3_0_seq = {
+    &ps7_clock_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_ddr_init_data_stream: 83 entries in 16 runs, 650 bytes */
+static const ps7_run_t ps7_ddr_init_data_stream_runs[] = {
+    { PS7_RUN_MASKWRITE, 7 }, { PS7_RUN_WRITE, 1 }, { PS7_RUN_MASKWRITE, 3 }, { PS7_RUN_WRITE, 2 },
+    { PS7_RUN_MASKWRITE, 3 }, { PS7_RUN_WRITE, 1 }, { PS7_RUN_MASKWRITE, 11 }, { PS7_RUN_WRITE, 1 },
+    { PS7_RUN_MASKWRITE, 38 }, { PS7_RUN_WRITE, 1 }, { PS7_RUN_MASKWRITE, 9 }, { PS7_RUN_WRITE, 1 },
+    { PS7_RUN_MASKWRITE, 2 }, { PS7_RUN_MASKPOLL, 1 }, { PS7_RUN_MASKWRITE, 1 }, { PS7_RUN_MASKPOLL, 1 },
+};
+static const unsigned short ps7_ddr_init_data_stream_addr[] = {
+    0x6000, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0008,
+    0x0008, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x000C, 0x0004,
+    0x0028, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x000C, 0x0000,
+    0x0004, 0x0014, 0x0014, 0x0004,
+    0x0020, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0008, 0x0004, 0x0004,
+    0x0004, 0x0008, 0x0004, 0x0004,
+    0x0004, 0x0008, 0x0004, 0x0004,
+    0x0004, 0x0008, 0x0004, 0x0004,
+    0x0004, 0x0008, 0x0004, 0x0004,
+    0x0004, 0x0008, 0x0004, 0x0070,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0084, 0x0004, 0x0004, 0x0004,
+    0xA8C0, 0x548C, 0x0054,
+};
+static const unsigned char ps7_ddr_init_data_stream_mask[] = {
+    15, 16, 17, 17,
+    17, 18, 19, 20,
+    21, 22, 23, 24,
+    25, 26, 27, 28,
+    29, 0, 30, 31,
+    17, 0, 17, 25,
+    26, 32, 33, 34,
+    35, 24, 24, 36,
+    4, 0, 37, 36,
+    38, 38, 38, 38,
+    25, 25, 25, 25,
+    25, 25, 25, 25,
+    25, 25, 25, 25,
+    18, 18, 18, 18,
+    25, 25, 25, 25,
+    39, 25, 40, 40,
+    40, 40, 41, 41,
+    41, 41, 42, 43,
+    44, 45, 15, 5,
+};
+static const unsigned long ps7_ddr_init_data_stream_val[] = {
+    0x00000084U, 0x00001040U, 0x03C0780FU, 0x02001001U,
+    0x00014001U, 0x0004159AU, 0x44D258D2U, 0x720238E5U,
+    0x270872D0U, 0x00000000U, 0x00002007U, 0x00000008U,
+    0x00040930U, 0x00011054U, 0x00000000U, 0x00000666U,
+    0xFFFF0000U, 0x0FF55555U, 0x0003C008U, 0x77010800U,
+    0x00000000U, 0x00005003U, 0x0000003EU, 0x00020000U,
+    0x00284141U, 0x00001610U, 0x00466111U, 0x00032222U,
+    0x10200802U, 0x0690CB52U, 0x000001FEU, 0x1CFFFFFFU,
+    0x00000200U, 0x00200066U, 0x00000003U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000008U,
+    0x00000000U, 0x40000001U, 0x40000001U, 0x40000000U,
+    0x40000000U, 0x0001B406U, 0x0001B006U, 0x00018000U,
+    0x00018000U, 0x00000035U, 0x00000035U, 0x00000035U,
+    0x00000035U, 0x00000086U, 0x00000086U, 0x00000080U,
+    0x00000080U, 0x000000C2U, 0x000000C1U, 0x000000B5U,
+    0x000000B5U, 0x000000C6U, 0x000000C6U, 0x000000C0U,
+    0x000000C0U, 0x00040080U, 0x0001FC82U, 0x00000000U,
+    0x000003FFU, 0x000003FFU, 0x000003FFU, 0x000003FFU,
+    0x000003FFU, 0x000003FFU, 0x000003FFU, 0x000003FFU,
+    0x00000000U, 0x00000000U, 0x00005125U, 0x000012A8U,
+    0x00000085U,
+};
+static const ps7_stream_t ps7_ddr_init_data_stream = {
+    ps7_ddr_init_data_stream_runs,
+    16,
+    ps7_ddr_init_data_stream_addr,
+    ps7_ddr_init_data_stream_mask,
+    ps7_ddr_init_data_stream_val,
+};
+
+const ps7_seq_t ps7_ddr_init_data_3_0_seq = {
+    &ps7_ddr_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_mio_init_data_stream: 71 entries in 3 runs, 525 bytes */
+static const ps7_run_t ps7_mio_init_data_stream_runs[] = {
+    { PS7_RUN_MASKWRITE, 8 }, { PS7_RUN_WRITE, 4 }, { PS7_RUN_MASKWRITE, 59 },
+};
+static const unsigned short ps7_mio_init_data_stream_addr[] = {
+    0x0008, 0x0B38, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0000, 0x0000,
+    0xFB90, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0xF830,
+};
+static const unsigned char ps7_mio_init_data_stream_mask[] = {
+    0, 46, 46, 46,
+    46, 46, 46, 46,
+    47, 4, 48, 49,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 22, 22,
+    22, 22, 0,
+};
+static const unsigned long ps7_mio_init_data_stream_val[] = {
+    0x0000DF0DU, 0x00000600U, 0x00000600U, 0x00000672U,
+    0x00000800U, 0x00000674U, 0x00000800U, 0x00000600U,
+    0x0018C61CU, 0x00F9861CU, 0x00F9861CU, 0x00F9861CU,
+    0x00000220U, 0x00000001U, 0x00000020U, 0x00000823U,
+    0x00001600U, 0x00001602U, 0x00000602U, 0x00000602U,
+    0x00000602U, 0x00000602U, 0x00000602U, 0x00000600U,
+    0x00000602U, 0x00001600U, 0x00001600U, 0x00001600U,
+    0x00001600U, 0x00001600U, 0x00001600U, 0x00001600U,
+    0x00001402U, 0x00001402U, 0x00001402U, 0x00001402U,
+    0x00001402U, 0x00001402U, 0x00001403U, 0x00001403U,
+    0x00001403U, 0x00001403U, 0x00001403U, 0x00001403U,
+    0x00001400U, 0x00001400U, 0x00001400U, 0x00001400U,
+    0x00001400U, 0x00001400U, 0x000014A0U, 0x000014A0U,
+    0x000014A0U, 0x000014A0U, 0x00001400U, 0x00001400U,
+    0x000014A0U, 0x000014A0U, 0x000014A0U, 0x00001400U,
+    0x00001400U, 0x000014A0U, 0x000014E1U, 0x000014E0U,
+    0x000014E0U, 0x000014E1U, 0x00001440U, 0x00001440U,
+    0x00001480U, 0x00001480U, 0x0000767BU,
+};
+static const ps7_stream_t ps7_mio_init_data_stream = {
+    ps7_mio_init_data_stream_runs,
+    3,
+    ps7_mio_init_data_stream_addr,
+    ps7_mio_init_data_stream_mask,
+    ps7_mio_init_data_stream_val,
+};
+
+const ps7_seq_t ps7_mio_init_data_3_0_seq = {
+    &ps7_mio_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_peripherals_init_data_stream: 25 entries in 4 runs, 204 bytes */
+static const ps7_run_t ps7_peripherals_init_data_stream_runs[] = {
+    { PS7_RUN_MASKWRITE, 14 }, { PS7_RUN_WRITE, 3 }, { PS7_RUN_MASKWRITE, 2 }, { PS7_RUN_MASKDELAY, 6 },
+};
+static const unsigned short ps7_peripherals_init_data_stream_addr[] = {
+    0x0008, 0x0B40, 0x0004, 0x0004,
+    0x0004, 0xF4B0, 0x8000, 0xE000,
+    0x1034, 0xFFE4, 0xFFE8, 0x0004,
+    0xF030, 0xFFE4, 0xFFE8, 0x0004,
+    0x8000, 0xF880, 0x3FB0, 0xF054,
+    0x0FAC, 0x8000, 0xE000, 0xD000,
+    0x8000, 0xF800, 0x7000, 0x8000,
+    0xF8F0, 0x0200, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000,
+};
+static const unsigned char ps7_peripherals_init_data_stream_mask[] = {
+    0, 50, 50, 50,
+    50, 0, 36, 0,
+    32, 51, 36, 0,
+    32, 51, 52, 53,
+    4, 4, 4, 4,
+    4, 4,
+};
+static const unsigned long ps7_peripherals_init_data_stream_val[] = {
+    0x0000DF0DU, 0x00000180U, 0x00000000U, 0x00000180U,
+    0x00000000U, 0x0000767BU, 0x00000006U, 0x0000007CU,
+    0x00000017U, 0x00000020U, 0x00000006U, 0x0000007CU,
+    0x00000017U, 0x00000020U, 0xC5ACCE55U, 0x00000002U,
+    0x00000000U, 0x00080000U, 0x00000000U,
+};
+static const ps7_stream_t ps7_peripherals_init_data_stream = {
+    ps7_peripherals_init_data_stream_runs,
+    4,
+    ps7_peripherals_init_data_stream_addr,
+    ps7_peripherals_init_data_stream_mask,
+    ps7_peripherals_init_data_stream_val,
+};
+
+const ps7_seq_t ps7_peripherals_init_data_3_0_seq = {
+    &ps7_peripherals_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_post_config_stream: 7 entries in 3 runs, 85 bytes */
+static const ps7_run_t ps7_post_config_stream_runs[] = {
+    { PS7_RUN_MASKWRITE, 2 }, { PS7_RUN_WRITE, 4 }, { PS7_RUN_MASKWRITE, 1 },
+};
+static const unsigned short ps7_post_config_stream_addr[] = {
+    0x0008, 0x08F8, 0x8000, 0xF880,
+    0x3FB0, 0xF054, 0x0FAC, 0x8000,
+    0xF800, 0x0240, 0xFDC4,
+};
+static const unsigned char ps7_post_config_stream_mask[] = {
+    0, 37, 0,
+};
+static const unsigned long ps7_post_config_stream_val[] = {
+    0x0000DF0DU, 0x0000000FU, 0xC5ACCE55U, 0x00000002U,
+    0x00000000U, 0x00000000U, 0x0000767BU,
+};
+static const ps7_stream_t ps7_post_config_stream = {
+    ps7_post_config_stream_runs,
+    3,
+    ps7_post_config_stream_addr,
+    ps7_post_config_stream_mask,
+    ps7_post_config_stream_val,
+};
+
+const ps7_seq_t ps7_post_config_3_0_seq = {
+    &ps7_post_config_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_debug_stream: 3 entries in 1 runs, 50 bytes */
+static const ps7_run_t ps7_debug_stream_runs[] = {
+    { PS7_RUN_WRITE, 3 },
+};
+static const unsigned short ps7_debug_stream_addr[] = {
+    0x8000, 0xF889, 0x8FB0, 0x1000,
+    0x8000, 0xF880, 0x9FB0,
+};
+static const unsigned long ps7_debug_stream_val[] = {
+    0xC5ACCE55U, 0xC5ACCE55U, 0xC5ACCE55U,
+};
+static const ps7_stream_t ps7_debug_stream = {
+    ps7_debug_stream_runs,
+    1,
+    ps7_debug_stream_addr,
+    0,
+    ps7_debug_stream_val,
+};
+
+const ps7_seq_t ps7_debug_3_0_seq = {
+    &ps7_debug_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_pll_init_data_2_0: ps7_pll_init_data_stream with 0 deltas */
+const ps7_seq_t ps7_pll_init_data_2_0_seq = {
+    &ps7_pll_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_clock_init_data_2_0: ps7_clock_init_data_stream with 0 deltas */
+const ps7_seq_t ps7_clock_init_data_2_0_seq = {
+    &ps7_clock_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_ddr_init_data_2_0: ps7_ddr_init_data_stream with 11 deltas */
+/* ps7_ddr_init_data_2_0_patch: 18 entries in 3 runs, 157 bytes */
+static const ps7_run_t ps7_ddr_init_data_2_0_patch_runs[] = {
+    { PS7_RUN_MASKWRITE, 12 }, { PS7_RUN_WRITE, 1 }, { PS7_RUN_MASKWRITE, 5 },
+};
+static const unsigned short ps7_ddr_init_data_2_0_patch_addr[] = {
+    0x6004, 0x001C, 0x0004, 0x0014,
+    0x0010, 0x0010, 0x0048, 0x0014,
+    0x0064, 0x0004, 0x0004, 0x0004,
+    0x006C, 0x0078, 0x0004, 0x0004,
+    0x0004, 0x0094,
+};
+static const unsigned char ps7_ddr_init_data_2_0_patch_mask[] = {
+    33, 54, 26, 55,
+    56, 15, 57, 58,
+    59, 59, 59, 59,
+    41, 41, 41, 41,
+    60,
+};
+static const unsigned long ps7_ddr_init_data_2_0_patch_val[] = {
+    0x00081040U, 0x272872D0U, 0x0000003CU, 0x00000000U,
+    0x0003C248U, 0x00000101U, 0x00008000U, 0x00000200U,
+    0x40000001U, 0x40000001U, 0x40000000U, 0x40000000U,
+    0x10040080U, 0x000803FFU, 0x000803FFU, 0x000803FFU,
+    0x000803FFU, 0x00000000U,
+};
+static const ps7_stream_t ps7_ddr_init_data_2_0_patch = {
+    ps7_ddr_init_data_2_0_patch_runs,
+    3,
+    ps7_ddr_init_data_2_0_patch_addr,
+    ps7_ddr_init_data_2_0_patch_mask,
+    ps7_ddr_init_data_2_0_patch_val,
+};
+
+static const ps7_delta_t ps7_ddr_init_data_2_0_delta[] = {
+    { 1, 1, 1 }, { 8, 2, 2 }, { 14, 1, 1 }, { 18, 1, 1 },
+    { 20, 1, 1 }, { 28, 0, 1 }, { 32, 1, 1 }, { 41, 4, 4 },
+    { 65, 1, 1 }, { 68, 4, 4 }, { 76, 1, 1 },
+};
+const ps7_seq_t ps7_ddr_init_data_2_0_seq = {
+    &ps7_ddr_init_data_stream,
+    ps7_ddr_init_data_2_0_delta,
+    11,
+    &ps7_ddr_init_data_2_0_patch,
+};
+
+/* ps7_mio_init_data_2_0: ps7_mio_init_data_stream with 2 deltas */
+/* ps7_mio_init_data_2_0_patch: 2 entries in 1 runs, 38 bytes */
+static const ps7_run_t ps7_mio_init_data_2_0_patch_runs[] = {
+    { PS7_RUN_MASKWRITE, 2 },
+};
+static const unsigned short ps7_mio_init_data_2_0_patch_addr[] = {
+    0x0B70, 0x0000,
+};
+static const unsigned char ps7_mio_init_data_2_0_patch_mask[] = {
+    48, 61,
+};
+static const unsigned long ps7_mio_init_data_2_0_patch_val[] = {
+    0x00000021U, 0x00000823U,
+};
+static const ps7_stream_t ps7_mio_init_data_2_0_patch = {
+    ps7_mio_init_data_2_0_patch_runs,
+    1,
+    ps7_mio_init_data_2_0_patch_addr,
+    ps7_mio_init_data_2_0_patch_mask,
+    ps7_mio_init_data_2_0_patch_val,
+};
+
+static const ps7_delta_t ps7_mio_init_data_2_0_delta[] = {
+    { 13, 1, 1 }, { 15, 1, 1 },
+};
+const ps7_seq_t ps7_mio_init_data_2_0_seq = {
+    &ps7_mio_init_data_stream,
+    ps7_mio_init_data_2_0_delta,
+    2,
+    &ps7_mio_init_data_2_0_patch,
+};
+
+/* ps7_peripherals_init_data_2_0: ps7_peripherals_init_data_stream with 2 deltas */
+/* ps7_peripherals_init_data_2_0_patch: 2 entries in 1 runs, 42 bytes */
+static const ps7_run_t ps7_peripherals_init_data_2_0_patch_runs[] = {
+    { PS7_RUN_MASKWRITE, 2 },
+};
+static const unsigned short ps7_peripherals_init_data_2_0_patch_addr[] = {
+    0x8000, 0xE000, 0x1004, 0xF000,
+};
+static const unsigned char ps7_peripherals_init_data_2_0_patch_mask[] = {
+    46, 46,
+};
+static const unsigned long ps7_peripherals_init_data_2_0_patch_val[] = {
+    0x00000020U, 0x00000020U,
+};
+static const ps7_stream_t ps7_peripherals_init_data_2_0_patch = {
+    ps7_peripherals_init_data_2_0_patch_runs,
+    1,
+    ps7_peripherals_init_data_2_0_patch_addr,
+    ps7_peripherals_init_data_2_0_patch_mask,
+    ps7_peripherals_init_data_2_0_patch_val,
+};
+
+static const ps7_delta_t ps7_peripherals_init_data_2_0_delta[] = {
+    { 9, 1, 1 }, { 13, 1, 1 },
+};
+const ps7_seq_t ps7_peripherals_init_data_2_0_seq = {
+    &ps7_peripherals_init_data_stream,
+    ps7_peripherals_init_data_2_0_delta,
+    2,
+    &ps7_peripherals_init_data_2_0_patch,
+};
+
+/* ps7_post_config_2_0: ps7_post_config_stream with 0 deltas */
+const ps7_seq_t ps7_post_config_2_0_seq = {
+    &ps7_post_config_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_debug_2_0: ps7_debug_stream with 0 deltas */
+const ps7_seq_t ps7_debug_2_0_seq = {
+    &ps7_debug_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_pll_init_data_1_0: ps7_pll_init_data_stream with 0 deltas */
+const ps7_seq_t ps7_pll_init_data_1_0_seq = {
+    &ps7_pll_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_clock_init_data_1_0: ps7_clock_init_data_stream with 0 deltas */
+const ps7_seq_t ps7_clock_init_data_1_0_seq = {
+    &ps7_clock_init_data_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_ddr_init_data_1_0: ps7_ddr_init_data_stream with 11 deltas */
+/* ps7_ddr_init_data_1_0_patch: 18 entries in 3 runs, 157 bytes */
+static const ps7_run_t ps7_ddr_init_data_1_0_patch_runs[] = {
+    { PS7_RUN_MASKWRITE, 12 }, { PS7_RUN_WRITE, 1 }, { PS7_RUN_MASKWRITE, 5 },
+};
+static const unsigned short ps7_ddr_init_data_1_0_patch_addr[] = {
+    0x6004, 0x001C, 0x0004, 0x0014,
+    0x0010, 0x0010, 0x0048, 0x0014,
+    0x0064, 0x0004, 0x0004, 0x0004,
+    0x006C, 0x0078, 0x0004, 0x0004,
+    0x0004, 0x0094,
+};
+static const unsigned char ps7_ddr_init_data_1_0_patch_mask[] = {
+    33, 54, 26, 55,
+    56, 15, 57, 58,
+    59, 59, 59, 59,
+    41, 41, 41, 41,
+    60,
+};
+static const unsigned long ps7_ddr_init_data_1_0_patch_val[] = {
+    0x00081040U, 0x272872D0U, 0x0000003CU, 0x00000000U,
+    0x0003C248U, 0x00000101U, 0x00008000U, 0x00000200U,
+    0x40000001U, 0x40000001U, 0x40000000U, 0x40000000U,
+    0x10040080U, 0x000803FFU, 0x000803FFU, 0x000803FFU,
+    0x000803FFU, 0x00000000U,
+};
+static const ps7_stream_t ps7_ddr_init_data_1_0_patch = {
+    ps7_ddr_init_data_1_0_patch_runs,
+    3,
+    ps7_ddr_init_data_1_0_patch_addr,
+    ps7_ddr_init_data_1_0_patch_mask,
+    ps7_ddr_init_data_1_0_patch_val,
+};
+
+static const ps7_delta_t ps7_ddr_init_data_1_0_delta[] = {
+    { 1, 1, 1 }, { 8, 2, 2 }, { 14, 1, 1 }, { 18, 1, 1 },
+    { 20, 1, 1 }, { 26, 2, 1 }, { 32, 1, 1 }, { 41, 4, 4 },
+    { 65, 1, 1 }, { 68, 4, 4 }, { 76, 1, 1 },
+};
+const ps7_seq_t ps7_ddr_init_data_1_0_seq = {
+    &ps7_ddr_init_data_stream,
+    ps7_ddr_init_data_1_0_delta,
+    11,
+    &ps7_ddr_init_data_1_0_patch,
+};
+
+/* ps7_mio_init_data_1_0: ps7_mio_init_data_stream with 2 deltas */
+/* ps7_mio_init_data_1_0_patch: 3 entries in 1 runs, 45 bytes */
+static const ps7_run_t ps7_mio_init_data_1_0_patch_runs[] = {
+    { PS7_RUN_MASKWRITE, 3 },
+};
+static const unsigned short ps7_mio_init_data_1_0_patch_addr[] = {
+    0x0B6C, 0x0004, 0x0000,
+};
+static const unsigned char ps7_mio_init_data_1_0_patch_mask[] = {
+    62, 48, 61,
+};
+static const unsigned long ps7_mio_init_data_1_0_patch_val[] = {
+    0x00000220U, 0x00000021U, 0x00000823U,
+};
+static const ps7_stream_t ps7_mio_init_data_1_0_patch = {
+    ps7_mio_init_data_1_0_patch_runs,
+    1,
+    ps7_mio_init_data_1_0_patch_addr,
+    ps7_mio_init_data_1_0_patch_mask,
+    ps7_mio_init_data_1_0_patch_val,
+};
+
+static const ps7_delta_t ps7_mio_init_data_1_0_delta[] = {
+    { 12, 2, 2 }, { 15, 1, 1 },
+};
+const ps7_seq_t ps7_mio_init_data_1_0_seq = {
+    &ps7_mio_init_data_stream,
+    ps7_mio_init_data_1_0_delta,
+    2,
+    &ps7_mio_init_data_1_0_patch,
+};
+
+/* ps7_peripherals_init_data_1_0: ps7_peripherals_init_data_stream with 2 deltas */
+/* ps7_peripherals_init_data_1_0_patch: 2 entries in 1 runs, 42 bytes */
+static const ps7_run_t ps7_peripherals_init_data_1_0_patch_runs[] = {
+    { PS7_RUN_MASKWRITE, 2 },
+};
+static const unsigned short ps7_peripherals_init_data_1_0_patch_addr[] = {
+    0x8000, 0xE000, 0x1004, 0xF000,
+};
+static const unsigned char ps7_peripherals_init_data_1_0_patch_mask[] = {
+    46, 46,
+};
+static const unsigned long ps7_peripherals_init_data_1_0_patch_val[] = {
+    0x00000020U, 0x00000020U,
+};
+static const ps7_stream_t ps7_peripherals_init_data_1_0_patch = {
+    ps7_peripherals_init_data_1_0_patch_runs,
+    1,
+    ps7_peripherals_init_data_1_0_patch_addr,
+    ps7_peripherals_init_data_1_0_patch_mask,
+    ps7_peripherals_init_data_1_0_patch_val,
+};
+
+static const ps7_delta_t ps7_peripherals_init_data_1_0_delta[] = {
+    { 9, 1, 1 }, { 13, 1, 1 },
+};
+const ps7_seq_t ps7_peripherals_init_data_1_0_seq = {
+    &ps7_peripherals_init_data_stream,
+    ps7_peripherals_init_data_1_0_delta,
+    2,
+    &ps7_peripherals_init_data_1_0_patch,
+};
+
+/* ps7_post_config_1_0: ps7_post_config_stream with 0 deltas */
+const ps7_seq_t ps7_post_config_1_0_seq = {
+    &ps7_post_config_stream,
+    0,
+    0,
+    0,
+};
+
+/* ps7_debug_1_0: ps7_debug_stream with 0 deltas */
+const ps7_seq_t ps7_debug_1_0_seq = {
+    &ps7_debug_stream,
+    0,
+    0,
+    0,
+};
+
+#ifdef PS7_WARM_RESET_FAST
+
+/* ps7_mio_init_data_3_0_warm: ps7_mio_init_data_stream with 1 deltas */
+static const ps7_delta_t ps7_mio_init_data_3_0_warm_delta[] = {
+    { 1, 15, 0 },
+};
+const ps7_seq_t ps7_mio_init_data_3_0_warm_seq = {
+    &ps7_mio_init_data_stream,
+    ps7_mio_init_data_3_0_warm_delta,
+    1,
+    0,
+};
+
+/* ps7_mio_init_data_2_0_warm: ps7_mio_init_data_stream with 1 deltas */
+static const ps7_delta_t ps7_mio_init_data_2_0_warm_delta[] = {
+    { 1, 15, 0 },
+};
+const ps7_seq_t ps7_mio_init_data_2_0_warm_seq = {
+    &ps7_mio_init_data_stream,
+    ps7_mio_init_data_2_0_warm_delta,
+    1,
+    0,
+};
+
+/* ps7_mio_init_data_1_0_warm: ps7_mio_init_data_stream with 1 deltas */
+static const ps7_delta_t ps7_mio_init_data_1_0_warm_delta[] = {
+    { 1, 15, 0 },
+};
+const ps7_seq_t ps7_mio_init_data_1_0_warm_seq = {
+    &ps7_mio_init_data_stream,
+    ps7_mio_init_data_1_0_warm_delta,
+    1,
+    0,
+};
+
+#endif /* PS7_WARM_RESET_FAST */
+
+#ifdef PS7_DDR_TRAIN_CACHE
+
+/* ps7_ddr_init_data_3_0_cfg: ps7_ddr_init_data_stream with 1 deltas */
+static const ps7_delta_t ps7_ddr_init_data_3_0_cfg_delta[] = {
+    { 81, 2, 0 },
+};
+const ps7_seq_t ps7_ddr_init_data_3_0_cfg_seq = {
+    &ps7_ddr_init_data_stream,
+    ps7_ddr_init_data_3_0_cfg_delta,
+    1,
+    0,
+};
+
+/* ps7_ddr_init_data_3_0_start: ps7_ddr_init_data_stream with 1 deltas */
+static const ps7_delta_t ps7_ddr_init_data_3_0_start_delta[] = {
+    { 0, 81, 0 },
+};
+const ps7_seq_t ps7_ddr_init_data_3_0_start_seq = {
+    &ps7_ddr_init_data_stream,
+    ps7_ddr_init_data_3_0_start_delta,
+    1,
+    0,
+};
+
+/* ps7_ddr_init_data_2_0_cfg: ps7_ddr_init_data_stream with 12 deltas */
+/* ps7_ddr_init_data_2_0_cfg_patch: 18 entries in 3 runs, 157 bytes */
+static const ps7_run_t ps7_ddr_init_data_2_0_cfg_patch_runs[] = {
+    { PS7_RUN_MASKWRITE, 12 }, { PS7_RUN_WRITE, 1 }, { PS7_RUN_MASKWRITE, 5 },
+};
+static const unsigned short ps7_ddr_init_data_2_0_cfg_patch_addr[] = {
+    0x6004, 0x001C, 0x0004, 0x0014,
+    0x0010, 0x0010, 0x0048, 0x0014,
+    0x0064, 0x0004, 0x0004, 0x0004,
+    0x006C, 0x0078, 0x0004, 0x0004,
+    0x0004, 0x0094,
+};
+static const unsigned char ps7_ddr_init_data_2_0_cfg_patch_mask[] = {
+    33, 54, 26, 55,
+    56, 15, 57, 58,
+    59, 59, 59, 59,
+    41, 41, 41, 41,
+    60,
+};
+static const unsigned long ps7_ddr_init_data_2_0_cfg_patch_val[] = {
+    0x00081040U, 0x272872D0U, 0x0000003CU, 0x00000000U,
+    0x0003C248U, 0x00000101U, 0x00008000U, 0x00000200U,
+    0x40000001U, 0x40000001U, 0x40000000U, 0x40000000U,
+    0x10040080U, 0x000803FFU, 0x000803FFU, 0x000803FFU,
+    0x000803FFU, 0x00000000U,
+};
+static const ps7_stream_t ps7_ddr_init_data_2_0_cfg_patch = {
+    ps7_ddr_init_data_2_0_cfg_patch_runs,
+    3,
+    ps7_ddr_init_data_2_0_cfg_patch_addr,
+    ps7_ddr_init_data_2_0_cfg_patch_mask,
+    ps7_ddr_init_data_2_0_cfg_patch_val,
+};
+
+static const ps7_delta_t ps7_ddr_init_data_2_0_cfg_delta[] = {
+    { 1, 1, 1 }, { 8, 2, 2 }, { 14, 1, 1 }, { 18, 1, 1 },
+    { 20, 1, 1 }, { 28, 0, 1 }, { 32, 1, 1 }, { 41, 4, 4 },
+    { 65, 1, 1 }, { 68, 4, 4 }, { 76, 1, 1 }, { 81, 2, 0 },
+};
+const ps7_seq_t ps7_ddr_init_data_2_0_cfg_seq = {
+    &ps7_ddr_init_data_stream,
+    ps7_ddr_init_data_2_0_cfg_delta,
+    12,
+    &ps7_ddr_init_data_2_0_cfg_patch,
+};
+
+/* ps7_ddr_init_data_2_0_start: ps7_ddr_init_data_stream with 1 deltas */
+static const ps7_delta_t ps7_ddr_init_data_2_0_start_delta[] = {
+    { 0, 81, 0 },
+};
+const ps7_seq_t ps7_ddr_init_data_2_0_start_seq = {
+    &ps7_ddr_init_data_stream,
+    ps7_ddr_init_data_2_0_start_delta,
+    1,
+    0,
+};
+
+/* ps7_ddr_init_data_1_0_cfg: ps7_ddr_init_data_stream with 12 deltas */
+/* ps7_ddr_init_data_1_0_cfg_patch: 18 entries in 3 runs, 157 bytes */
+static const ps7_run_t ps7_ddr_init_data_1_0_cfg_patch_runs[] = {
+    { PS7_RUN_MASKWRITE, 12 }, { PS7_RUN_WRITE, 1 }, { PS7_RUN_MASKWRITE, 5 },
+};
+static const unsigned short ps7_ddr_init_data_1_0_cfg_patch_addr[] = {
+    0x6004, 0x001C, 0x0004, 0x0014,
+    0x0010, 0x0010, 0x0048, 0x0014,
+    0x0064, 0x0004, 0x0004, 0x0004,
+    0x006C, 0x0078, 0x0004, 0x0004,
+    0x0004, 0x0094,
+};
+static const unsigned char ps7_ddr_init_data_1_0_cfg_patch_mask[] = {
+    33, 54, 26, 55,
+    56, 15, 57, 58,
+    59, 59, 59, 59,
+    41, 41, 41, 41,
+    60,
+};
+static const unsigned long ps7_ddr_init_data_1_0_cfg_patch_val[] = {
+    0x00081040U, 0x272872D0U, 0x0000003CU, 0x00000000U,
+    0x0003C248U, 0x00000101U, 0x00008000U, 0x00000200U,
+    0x40000001U, 0x40000001U, 0x40000000U, 0x40000000U,
+    0x10040080U, 0x000803FFU, 0x000803FFU, 0x000803FFU,
+    0x000803FFU, 0x00000000U,
+};
+static const ps7_stream_t ps7_ddr_init_data_1_0_cfg_patch = {
+    ps7_ddr_init_data_1_0_cfg_patch_runs,
+    3,
+    ps7_ddr_init_data_1_0_cfg_patch_addr,
+    ps7_ddr_init_data_1_0_cfg_patch_mask,
+    ps7_ddr_init_data_1_0_cfg_patch_val,
+};
+
+static const ps7_delta_t ps7_ddr_init_data_1_0_cfg_delta[] = {
+    { 1, 1, 1 }, { 8, 2, 2 }, { 14, 1, 1 }, { 18, 1, 1 },
+    { 20, 1, 1 }, { 26, 2, 1 }, { 32, 1, 1 }, { 41, 4, 4 },
+    { 65, 1, 1 }, { 68, 4, 4 }, { 76, 1, 1 }, { 81, 2, 0 },
+};
+const ps7_seq_t ps7_ddr_init_data_1_0_cfg_seq = {
+    &ps7_ddr_init_data_stream,
+    ps7_ddr_init_data_1_0_cfg_delta,
+    12,
+    &ps7_ddr_init_data_1_0_cfg_patch,
+};
+
+/* ps7_ddr_init_data_1_0_start: ps7_ddr_init_data_stream with 1 deltas */
+static const ps7_delta_t ps7_ddr_init_data_1_0_start_delta[] = {
+    { 0, 81, 0 },
+};
+const ps7_seq_t ps7_ddr_init_data_1_0_start_seq = {
+    &ps7_ddr_init_data_stream,
+    ps7_ddr_init_data_1_0_start_delta,
+    1,
+    0,
+};
+
+#endif /* PS7_DDR_TRAIN_CACHE */
+
+#if defined(PS7_WARM_RESET_FAST) || defined(PS7_DDR_TRAIN_CACHE)
+
+/* ps7_warm_fp_3_0: 99 registers */
+static const unsigned long ps7_warm_fp_3_0_addr[] = {
+    0xF8000B40U, 0xF8000B44U, 0xF8000B48U, 0xF8000B4CU,
+    0xF8000B50U, 0xF8000B54U, 0xF8000B58U, 0xF8000B5CU,
+    0xF8000B60U, 0xF8000B64U, 0xF8000B68U, 0xF8000B6CU,
+    0xF8000110U, 0xF8000100U, 0xF8000120U, 0xF8000114U,
+    0xF8000104U, 0xF8000124U, 0xF8000118U, 0xF8000108U,
+    0xF8006000U, 0xF8006004U, 0xF8006008U, 0xF800600CU,
+    0xF8006010U, 0xF8006014U, 0xF8006018U, 0xF800601CU,
+    0xF8006020U, 0xF8006024U, 0xF8006028U, 0xF800602CU,
+    0xF8006030U, 0xF8006034U, 0xF8006038U, 0xF800603CU,
+    0xF8006040U, 0xF8006044U, 0xF8006048U, 0xF8006050U,
+    0xF8006058U, 0xF800605CU, 0xF8006060U, 0xF8006064U,
+    0xF8006068U, 0xF800606CU, 0xF8006078U, 0xF800607CU,
+    0xF80060A4U, 0xF80060A8U, 0xF80060ACU, 0xF80060B0U,
+    0xF80060B4U, 0xF80060B8U, 0xF80060C4U, 0xF80060C8U,
+    0xF80060DCU, 0xF80060F0U, 0xF80060F4U, 0xF8006114U,
+    0xF8006118U, 0xF800611CU, 0xF8006120U, 0xF8006124U,
+    0xF800612CU, 0xF8006130U, 0xF8006134U, 0xF8006138U,
+    0xF8006140U, 0xF8006144U, 0xF8006148U, 0xF800614CU,
+    0xF8006154U, 0xF8006158U, 0xF800615CU, 0xF8006160U,
+    0xF8006168U, 0xF800616CU, 0xF8006170U, 0xF8006174U,
+    0xF800617CU, 0xF8006180U, 0xF8006184U, 0xF8006188U,
+    0xF8006190U, 0xF8006194U, 0xF8006204U, 0xF8006208U,
+    0xF800620CU, 0xF8006210U, 0xF8006214U, 0xF8006218U,
+    0xF800621CU, 0xF8006220U, 0xF8006224U, 0xF80062A8U,
+    0xF80062ACU, 0xF80062B0U, 0xF80062B4U,
+};
+static const unsigned long ps7_warm_fp_3_0_mask[] = {
+    0x00000FFFU, 0x00000FFFU, 0x00000FFFU, 0x00000FFFU,
+    0x00000FFFU, 0x00000FFFU, 0x00000FFFU, 0xFFFFFFFFU,
+    0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0x00007FFFU,
+    0x003FFFF0U, 0x0007F011U, 0x1F003F30U, 0x003FFFF0U,
+    0x0007F011U, 0xFFF00003U, 0x003FFFF0U, 0x0007F011U,
+    0x0001FFFFU, 0x0007FFFFU, 0x03FFFFFFU, 0x03FFFFFFU,
+    0x03FFFFFFU, 0x001FFFFFU, 0xF7FFFFFFU, 0xFFFFFFFFU,
+    0x7FDFFFFCU, 0x0FFFFFC3U, 0x00003FFFU, 0xFFFFFFFFU,
+    0xFFFFFFFFU, 0x13FF3FFFU, 0x00000003U, 0x000FFFFFU,
+    0xFFFFFFFFU, 0x0FFFFFFFU, 0x0003F03FU, 0xFF0F8FFFU,
+    0x00010000U, 0x0000FFFFU, 0x000017FFU, 0x00021FE0U,
+    0x03FFFFFFU, 0x0000FFFFU, 0x03FFFFFFU, 0x000FFFFFU,
+    0xFFFFFFFFU, 0x0FFFFFFFU, 0x000001FFU, 0x1FFFFFFFU,
+    0x00000200U, 0x01FFFFFFU, 0x00000003U, 0x000000FFU,
+    0x00000001U, 0x0000FFFFU, 0x0000000FU, 0x000000FFU,
+    0x7FFFFFCFU, 0x7FFFFFCFU, 0x7FFFFFCFU, 0x7FFFFFCFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x001FFFFFU, 0x001FFFFFU, 0x001FFFFFU, 0x001FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x6FFFFEFEU, 0x000FFFFFU, 0xFFFFFFFFU, 0x000703FFU,
+    0x000703FFU, 0x000703FFU, 0x000703FFU, 0x000F03FFU,
+    0x000F03FFU, 0x000F03FFU, 0x000F03FFU, 0x00000FF5U,
+    0xFFFFFFFFU, 0x003FFFFFU, 0x0003FFFFU,
+};
+const ps7_fp_t ps7_warm_fp_3_0 = {
+    ps7_warm_fp_3_0_addr,
+    ps7_warm_fp_3_0_mask,
+    99,
+    0x319A55EEU,
+};
+
+/* ps7_warm_fp_2_0: 100 registers */
+static const unsigned long ps7_warm_fp_2_0_addr[] = {
+    0xF8000B40U, 0xF8000B44U, 0xF8000B48U, 0xF8000B4CU,
+    0xF8000B50U, 0xF8000B54U, 0xF8000B58U, 0xF8000B5CU,
+    0xF8000B60U, 0xF8000B64U, 0xF8000B68U, 0xF8000B6CU,
+    0xF8000110U, 0xF8000100U, 0xF8000120U, 0xF8000114U,
+    0xF8000104U, 0xF8000124U, 0xF8000118U, 0xF8000108U,
+    0xF8006000U, 0xF8006004U, 0xF8006008U, 0xF800600CU,
+    0xF8006010U, 0xF8006014U, 0xF8006018U, 0xF800601CU,
+    0xF8006020U, 0xF8006024U, 0xF8006028U, 0xF800602CU,
+    0xF8006030U, 0xF8006034U, 0xF8006038U, 0xF800603CU,
+    0xF8006040U, 0xF8006044U, 0xF8006048U, 0xF8006050U,
+    0xF8006058U, 0xF800605CU, 0xF8006060U, 0xF8006064U,
+    0xF8006068U, 0xF800606CU, 0xF8006078U, 0xF800607CU,
+    0xF80060A0U, 0xF80060A4U, 0xF80060A8U, 0xF80060ACU,
+    0xF80060B0U, 0xF80060B4U, 0xF80060B8U, 0xF80060C4U,
+    0xF80060C8U, 0xF80060DCU, 0xF80060F0U, 0xF80060F4U,
+    0xF8006114U, 0xF8006118U, 0xF800611CU, 0xF8006120U,
+    0xF8006124U, 0xF800612CU, 0xF8006130U, 0xF8006134U,
+    0xF8006138U, 0xF8006140U, 0xF8006144U, 0xF8006148U,
+    0xF800614CU, 0xF8006154U, 0xF8006158U, 0xF800615CU,
+    0xF8006160U, 0xF8006168U, 0xF800616CU, 0xF8006170U,
+    0xF8006174U, 0xF800617CU, 0xF8006180U, 0xF8006184U,
+    0xF8006188U, 0xF8006190U, 0xF8006194U, 0xF8006204U,
+    0xF8006208U, 0xF800620CU, 0xF8006210U, 0xF8006214U,
+    0xF8006218U, 0xF800621CU, 0xF8006220U, 0xF8006224U,
+    0xF80062A8U, 0xF80062ACU, 0xF80062B0U, 0xF80062B4U,
+};
+static const unsigned long ps7_warm_fp_2_0_mask[] = {
+    0x00000FFFU, 0x00000FFFU, 0x00000FFFU, 0x00000FFFU,
+    0x00000FFFU, 0x00000FFFU, 0x00000FFFU, 0xFFFFFFFFU,
+    0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0x00007FFFU,
+    0x003FFFF0U, 0x0007F011U, 0x1F003F30U, 0x003FFFF0U,
+    0x0007F011U, 0xFFF00003U, 0x003FFFF0U, 0x0007F011U,
+    0x0001FFFFU, 0x1FFFFFFFU, 0x03FFFFFFU, 0x03FFFFFFU,
+    0x03FFFFFFU, 0x001FFFFFU, 0xF7FFFFFFU, 0xFFFFFFFFU,
+    0xFFFFFFFCU, 0x0FFFFFFFU, 0x00003FFFU, 0xFFFFFFFFU,
+    0xFFFFFFFFU, 0x13FF3FFFU, 0x00001FC3U, 0x000FFFFFU,
+    0xFFFFFFFFU, 0x0FFFFFFFU, 0x3FFFFFFFU, 0xFF0F8FFFU,
+    0x0001FFFFU, 0x0000FFFFU, 0x000017FFU, 0x00021FE0U,
+    0x03FFFFFFU, 0x0000FFFFU, 0x03FFFFFFU, 0x000FFFFFU,
+    0x00FFFFFFU, 0xFFFFFFFFU, 0x0FFFFFFFU, 0x000001FFU,
+    0x1FFFFFFFU, 0x000007FFU, 0x01FFFFFFU, 0x00000003U,
+    0x000000FFU, 0x00000001U, 0x0000FFFFU, 0x0000000FU,
+    0x000000FFU, 0x7FFFFFFFU, 0x7FFFFFFFU, 0x7FFFFFFFU,
+    0x7FFFFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x001FFFFFU, 0x001FFFFFU, 0x001FFFFFU,
+    0x001FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0xFFFFFFFFU, 0x000FFFFFU, 0xFFFFFFFFU,
+    0x000F03FFU, 0x000F03FFU, 0x000F03FFU, 0x000F03FFU,
+    0x000F03FFU, 0x000F03FFU, 0x000F03FFU, 0x000F03FFU,
+    0x00000FF7U, 0xFFFFFFFFU, 0x003FFFFFU, 0x0003FFFFU,
+};
+const ps7_fp_t ps7_warm_fp_2_0 = {
+    ps7_warm_fp_2_0_addr,
+    ps7_warm_fp_2_0_mask,
+    100,
+    0xA3007280U,
+};
+
+/* ps7_warm_fp_1_0: 98 registers */
+static const unsigned long ps7_warm_fp_1_0_addr[] = {
+    0xF8000B40U, 0xF8000B44U, 0xF8000B48U, 0xF8000B4CU,
+    0xF8000B50U, 0xF8000B54U, 0xF8000B58U, 0xF8000B5CU,
+    0xF8000B60U, 0xF8000B64U, 0xF8000B68U, 0xF8000B6CU,
+    0xF8000110U, 0xF8000100U, 0xF8000120U, 0xF8000114U,
+    0xF8000104U, 0xF8000124U, 0xF8000118U, 0xF8000108U,
+    0xF8006000U, 0xF8006004U, 0xF8006008U, 0xF800600CU,
+    0xF8006010U, 0xF8006014U, 0xF8006018U, 0xF800601CU,
+    0xF8006020U, 0xF8006024U, 0xF8006028U, 0xF800602CU,
+    0xF8006030U, 0xF8006034U, 0xF8006038U, 0xF800603CU,
+    0xF8006040U, 0xF8006044U, 0xF8006048U, 0xF8006050U,
+    0xF8006058U, 0xF800605CU, 0xF8006060U, 0xF8006064U,
+    0xF8006068U, 0xF800606CU, 0xF80060A0U, 0xF80060A4U,
+    0xF80060A8U, 0xF80060ACU, 0xF80060B0U, 0xF80060B4U,
+    0xF80060B8U, 0xF80060C4U, 0xF80060C8U, 0xF80060DCU,
+    0xF80060F0U, 0xF80060F4U, 0xF8006114U, 0xF8006118U,
+    0xF800611CU, 0xF8006120U, 0xF8006124U, 0xF800612CU,
+    0xF8006130U, 0xF8006134U, 0xF8006138U, 0xF8006140U,
+    0xF8006144U, 0xF8006148U, 0xF800614CU, 0xF8006154U,
+    0xF8006158U, 0xF800615CU, 0xF8006160U, 0xF8006168U,
+    0xF800616CU, 0xF8006170U, 0xF8006174U, 0xF800617CU,
+    0xF8006180U, 0xF8006184U, 0xF8006188U, 0xF8006190U,
+    0xF8006194U, 0xF8006204U, 0xF8006208U, 0xF800620CU,
+    0xF8006210U, 0xF8006214U, 0xF8006218U, 0xF800621CU,
+    0xF8006220U, 0xF8006224U, 0xF80062A8U, 0xF80062ACU,
+    0xF80062B0U, 0xF80062B4U,
+};
+static const unsigned long ps7_warm_fp_1_0_mask[] = {
+    0x00000FFFU, 0x00000FFFU, 0x00000FFFU, 0x00000FFFU,
+    0x00000FFFU, 0x00000FFFU, 0x00000FFFU, 0xFFFFFFFFU,
+    0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0x000073FFU,
+    0x003FFFF0U, 0x0007F011U, 0x1F003F30U, 0x003FFFF0U,
+    0x0007F011U, 0xFFF00003U, 0x003FFFF0U, 0x0007F011U,
+    0x0001FFFFU, 0x1FFFFFFFU, 0x03FFFFFFU, 0x03FFFFFFU,
+    0x03FFFFFFU, 0x001FFFFFU, 0xF7FFFFFFU, 0xFFFFFFFFU,
+    0xFFFFFFFCU, 0x0FFFFFFFU, 0x00003FFFU, 0xFFFFFFFFU,
+    0xFFFFFFFFU, 0x13FF3FFFU, 0x00001FC3U, 0x000FFFFFU,
+    0xFFFFFFFFU, 0x0FFFFFFFU, 0x3FFFFFFFU, 0xFF0F8FFFU,
+    0x0001FFFFU, 0x0000FFFFU, 0x000017FFU, 0x00021FE0U,
+    0x03FFFFFFU, 0x0000FFFFU, 0x00FFFFFFU, 0xFFFFFFFFU,
+    0x0FFFFFFFU, 0x000001FFU, 0x1FFFFFFFU, 0x000007FFU,
+    0x01FFFFFFU, 0x00000003U, 0x000000FFU, 0x00000001U,
+    0x0000FFFFU, 0x0000000FU, 0x000000FFU, 0x7FFFFFFFU,
+    0x7FFFFFFFU, 0x7FFFFFFFU, 0x7FFFFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0x001FFFFFU,
+    0x001FFFFFU, 0x001FFFFFU, 0x001FFFFFU, 0x000FFFFFU,
+    0x000FFFFFU, 0x000FFFFFU, 0x000FFFFFU, 0xFFFFFFFFU,
+    0x000FFFFFU, 0xFFFFFFFFU, 0x000F03FFU, 0x000F03FFU,
+    0x000F03FFU, 0x000F03FFU, 0x000F03FFU, 0x000F03FFU,
+    0x000F03FFU, 0x000F03FFU, 0x00000FF7U, 0xFFFFFFFFU,
+    0x003FFFFFU, 0x0003FFFFU,
+};
+const ps7_fp_t ps7_warm_fp_1_0 = {
+    ps7_warm_fp_1_0_addr,
+    ps7_warm_fp_1_0_mask,
+    98,
+    0x36D74611U,
+};
+
+#endif
+
+#endif /* PS7_INIT_PRECOMPILED */
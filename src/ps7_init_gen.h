@@ -0,0 +1,227 @@
+/******************************************************************************
+*
+* (c) Copyright 2010-2014 Xilinx, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this
+* software and associated documentation files (the "Software"), to deal in the Software
+* without restriction, including without limitation the rights to use, copy, modify, merge,
+* publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+* persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or
+* substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications: (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+* BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE X CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used in advertising or
+* otherwise to promote the sale, use or other dealings in this Software without prior written
+* authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file ps7_init_gen.h
+*
+* Format of the precompiled ps7_init register sequences.
+*
+* tools/ps7_compile.py turns each EMIT_* table of ps7_init.c into a
+* ps7_seq_t in ps7_init_gen.c. The entries are stored in a ps7_stream_t,
+* a list of runs of the same operation over three packed arrays:
+*	- addr, one entry per operation, as the signed 16 bit distance to
+*	  the previous address, or PS7_ADDR_FAR followed by the address
+*	- mask, one entry per MASKWRITE, MASKPOLL and MASKDELAY, an index
+*	  into the shared ps7_masks[]
+*	- val, one entry per WRITE and MASKWRITE, already masked
+* so ps7_run() dispatches once per run instead of decoding every entry.
+*
+* The silicon versions differ in a few DDR, MIO and peripheral settings
+* only. Each kind of table is stored once, as the stream of its first
+* version, and every sequence is that base stream plus ps7_delta_t
+* patches: at a base entry, skip some base entries and run some entries
+* of the patch stream instead. ps7_run() applies them while it runs the
+* base, nothing is expanded into RAM. The warm reset MIO and the split
+* DDR sequences below are built the same way.
+*
+* The PLL sequences are reordered by the script so that the three PLLs
+* are released from reset together and share one MASKPOLL_ALL on the
+* lock bits, the PLLs then lock in parallel instead of one after another.
+*
+* PS7_INIT_PRECOMPILED is the default, define PS7_INIT_INTERPRETED to go
+* back to the ps7_config() table walk.
+*
+* With PS7_WARM_RESET_FAST, ps7_init() skips the PLL and DDR stages after
+* a reset that left them running: the PLLs are locked, the DDRC is in
+* normal operation and the PLL/DDRIOB/DDRC registers match the generated
+* ps7_fp_t fingerprint of the configuration the tables would write. MIO
+* (without its DDRIOB part), clock and peripheral setup are redone.
+*
+* With PS7_DDR_TRAIN_CACHE the PHY training results (read data eye, gate
+* and write leveling ratios of each data slice) are kept in a
+* ps7_ddr_train_t record. A valid record, found in OCM after a reset or
+* in the boot flash at PS7_DDR_TRAIN_FLASH_OFFSET, is programmed as PHY
+* slave ratios with the training turned off if every ratio is within
+* PS7_DDR_TRAIN_WINDOW of the ratio the PCW programs. The FSBL verifies
+* DDR and calls ps7_ddr_retrain() if the record did not work, or
+* ps7_ddr_train_commit() to record a fresh training result. When booting
+* from QSPI the FSBL also writes a fresh record to the flash.
+*
+* Regenerate ps7_init_gen.c whenever ps7_init.c is regenerated by the
+* tools and run the script with --check.
+*
+*****************************************************************************/
+#ifndef __PS7_INIT_GEN_H__
+#define __PS7_INIT_GEN_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef PS7_INIT_INTERPRETED
+#define PS7_INIT_PRECOMPILED
+#endif
+
+#if defined(PS7_WARM_RESET_FAST) && !defined(PS7_INIT_PRECOMPILED)
+#undef PS7_WARM_RESET_FAST
+#endif
+
+#if defined(PS7_DDR_TRAIN_CACHE) && !defined(PS7_INIT_PRECOMPILED)
+#undef PS7_DDR_TRAIN_CACHE
+#endif
+
+/* OCM block reserved for the training record in lscript.ld */
+#define PS7_DDR_TRAIN_ADDR	0xFFFFF900
+#define PS7_DDR_TRAIN_MAGIC	0x4E525444	/* "DTRN" */
+#define PS7_DDR_TRAIN_VERSION	1
+#define PS7_DDR_TRAIN_SLICES	4
+
+/* Largest distance of a recorded ratio from the PCW one, in 1/256 clock */
+#ifndef PS7_DDR_TRAIN_WINDOW
+#define PS7_DDR_TRAIN_WINDOW	0x80
+#endif
+
+#define PS7_RUN_WRITE		0
+#define PS7_RUN_MASKWRITE	1
+#define PS7_RUN_MASKPOLL	2
+#define PS7_RUN_MASKDELAY	3
+#define PS7_RUN_MASKPOLL_ALL	4	/* waits for all the bits of the mask */
+
+/* Address deltas start from PS7_ADDR_ORIGIN in every stream */
+#define PS7_ADDR_ORIGIN		0xF8000000
+#define PS7_ADDR_FAR		0x8000	/* next two words: address [31:16], [15:0] */
+
+typedef struct {
+	unsigned short op;
+	unsigned short count;
+} ps7_run_t;
+
+typedef struct {
+	const ps7_run_t *runs;
+	unsigned long nruns;
+	const unsigned short *addr;
+	const unsigned char *mask;
+	const unsigned long *val;
+} ps7_stream_t;
+
+typedef struct {
+	unsigned short at;	/* base entry the delta applies at */
+	unsigned short skip;	/* base entries left out from there */
+	unsigned short count;	/* patch entries run instead */
+} ps7_delta_t;
+
+typedef struct {
+	const ps7_stream_t *base;
+	const ps7_delta_t *delta;	/* sorted by at */
+	unsigned long ndelta;
+	const ps7_stream_t *patch;
+} ps7_seq_t;
+
+typedef struct {
+	const unsigned long *addr;
+	const unsigned long *mask;
+	unsigned long count;
+	unsigned long sum;	/* refer to ps7_fingerprint() */
+} ps7_fp_t;
+
+typedef struct {
+	unsigned long magic;
+	unsigned long version;
+	unsigned long config;	/* ps7_fp_t sum of the DDR set up trained */
+	unsigned long result[PS7_DDR_TRAIN_SLICES];	/* reg6e_71x */
+	unsigned long checksum;	/* ones complement of the sum of the above */
+} ps7_ddr_train_t;
+
+#ifdef PS7_INIT_PRECOMPILED
+int ps7_run(const ps7_seq_t *seq);
+
+extern const unsigned long ps7_masks[];
+
+extern const ps7_seq_t ps7_pll_init_data_3_0_seq;
+extern const ps7_seq_t ps7_clock_init_data_3_0_seq;
+extern const ps7_seq_t ps7_ddr_init_data_3_0_seq;
+extern const ps7_seq_t ps7_mio_init_data_3_0_seq;
+extern const ps7_seq_t ps7_peripherals_init_data_3_0_seq;
+extern const ps7_seq_t ps7_post_config_3_0_seq;
+extern const ps7_seq_t ps7_debug_3_0_seq;
+extern const ps7_seq_t ps7_pll_init_data_2_0_seq;
+extern const ps7_seq_t ps7_clock_init_data_2_0_seq;
+extern const ps7_seq_t ps7_ddr_init_data_2_0_seq;
+extern const ps7_seq_t ps7_mio_init_data_2_0_seq;
+extern const ps7_seq_t ps7_peripherals_init_data_2_0_seq;
+extern const ps7_seq_t ps7_post_config_2_0_seq;
+extern const ps7_seq_t ps7_debug_2_0_seq;
+extern const ps7_seq_t ps7_pll_init_data_1_0_seq;
+extern const ps7_seq_t ps7_clock_init_data_1_0_seq;
+extern const ps7_seq_t ps7_ddr_init_data_1_0_seq;
+extern const ps7_seq_t ps7_mio_init_data_1_0_seq;
+extern const ps7_seq_t ps7_peripherals_init_data_1_0_seq;
+extern const ps7_seq_t ps7_post_config_1_0_seq;
+extern const ps7_seq_t ps7_debug_1_0_seq;
+#endif
+
+#ifdef PS7_WARM_RESET_FAST
+extern const ps7_seq_t ps7_mio_init_data_3_0_warm_seq;
+extern const ps7_seq_t ps7_mio_init_data_2_0_warm_seq;
+extern const ps7_seq_t ps7_mio_init_data_1_0_warm_seq;
+
+/* Set by ps7_init() when the PLL and DDR stages were skipped */
+extern unsigned long ps7_warm_boot;
+#else
+#define ps7_warm_boot	0
+#endif
+
+#ifdef PS7_DDR_TRAIN_CACHE
+extern const ps7_seq_t ps7_ddr_init_data_3_0_cfg_seq;
+extern const ps7_seq_t ps7_ddr_init_data_3_0_start_seq;
+extern const ps7_seq_t ps7_ddr_init_data_2_0_cfg_seq;
+extern const ps7_seq_t ps7_ddr_init_data_2_0_start_seq;
+extern const ps7_seq_t ps7_ddr_init_data_1_0_cfg_seq;
+extern const ps7_seq_t ps7_ddr_init_data_1_0_start_seq;
+
+/* Set by ps7_init() when DDR was set up from a training record */
+extern unsigned long ps7_ddr_trained;
+
+void ps7_ddr_train_commit(void);
+int ps7_ddr_retrain(void);
+#else
+#define ps7_ddr_trained	0
+#endif
+
+#if defined(PS7_WARM_RESET_FAST) || defined(PS7_DDR_TRAIN_CACHE)
+extern const ps7_fp_t ps7_warm_fp_3_0;
+extern const ps7_fp_t ps7_warm_fp_2_0;
+extern const ps7_fp_t ps7_warm_fp_1_0;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PS7_INIT_GEN_H__ */
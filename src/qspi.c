@@ -58,6 +58,9 @@
 * 7.00a kc  10/25/13 Fix for CR#739968 - FSBL should do the QSPI config
 *                    					 settings for Dual parallel
 *                    					 configuration in IO mode
+* 12.00a hx 10/18/26 QspiAccess copies with the DMAC copy service
+*                    Added QspiAccessV
+*                    Added QspiFlashWrite
 *
 * </pre>
 *
@@ -67,6 +70,7 @@
 
 /***************************** Include Files *********************************/
 
+#include <string.h>
 #include "qspi.h"
 #include "image_mover.h"
 #include "sleep.h"
@@ -79,9 +83,18 @@
 #include "qspi_flash_spansion.h"
 
 #include "dbg_print.h"
+#include "fsbl_pmu.h"
+#include "fsbl_dma.h"
+#include "fsbl_poll.h"
+#include "xil_cache.h"
 
 /************************** Constant Definitions *****************************/
 
+/*
+ * Gap in bytes QspiAccessV reads through to save a flash command
+ */
+#define QSPI_MOVE_V_GAP		256
+
 /*
  * The following constants map to the XPAR parameters created in the
  * xparameters.h file. They are defined here such that a user can easily
@@ -104,6 +117,9 @@
 
 #define WRITE_ENABLE_CMD	0x06
 #define WRITE_DISABLE_CMD	0x04
+#define READ_STATUS_CMD		0x05
+#define PAGE_PROGRAM_CMD	0x02
+#define SECTOR_ERASE_CMD	0xD8
 #define BANK_REG_RD			0x16
 #define BANK_REG_WR			0x17
 /* Bank register is called Extended Address Reg in Micron */
@@ -124,6 +140,8 @@
 #define RD_ID_SIZE			4 /* Read ID command + 3 bytes ID response */
 #define BANK_SEL_SIZE		2 /* BRWR or EARWR command + 1 byte bank value */
 #define WRITE_ENABLE_CMD_SIZE	1 /* WE command */
+#define READ_STATUS_SIZE	2 /* RDSR command + 1 byte status */
+#define SECTOR_ERASE_SIZE	4 /* SE command + 3 bytes address */
 /*
  * The following constants specify the extra bytes which are sent to the
  * FLASH on the QSPI interface, that are not data, but control information
@@ -138,6 +156,14 @@
  */
 #define DATA_SIZE		4096
 
+/*
+ * Erase sector and program page of the flash, QspiFlashWrite programs one
+ * page of a sector it erases first
+ */
+#define FLASH_SECTOR_SIZE	0x10000
+#define FLASH_PAGE_SIZE		256
+#define FLASH_SR_WIP_MASK	0x01 /* Write in progress */
+
 /*
  * The following defines are for dual flash interface.
  */
@@ -179,6 +205,10 @@ typedef struct {
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static u32 FlashWriteEnable(void);
+static u32 FlashWaitReady(void);
+static void FlashIoMode(void);
+static void FlashLinearMode(void);
 
 /************************** Variable Definitions *****************************/
 
@@ -644,6 +674,8 @@ u32 QspiAccess( u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 	u32 Status;
 	u8 BankSwitchFlag = 1;
 
+	PMU_SCOPE_BEGIN(PMU_SCOPE_QSPI_ACCESS);
+
 	/*
 	 * Linear access check
 	 */
@@ -655,9 +687,17 @@ u32 QspiAccess( u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 			LengthBytes += (4 - (LengthBytes & 0x00000003));
 		}
 
-		memcpy((void*)DestinationAddress,
-		      (const void*)(SourceAddress + FlashReadBaseAddress),
-		      (size_t)LengthBytes);
+		Status = DmaCopyAsync(SourceAddress + FlashReadBaseAddress,
+				DestinationAddress, LengthBytes);
+		if (Status == XST_SUCCESS) {
+			Status = DmaWait();
+		}
+		if (Status != XST_SUCCESS) {
+			fsbl_printf(DEBUG_INFO,"QspiAccess: DMA failed, CPU copy\r\n");
+			memcpy((void *)DestinationAddress,
+					(const void *)(SourceAddress + FlashReadBaseAddress),
+					LengthBytes);
+		}
 	} else {
 		/*
 		 * Non Linear access
@@ -725,6 +765,7 @@ u32 QspiAccess( u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 				Status = SendBankSelect(BankSel);
 				if (Status != XST_SUCCESS) {
 					fsbl_printf(DEBUG_INFO, "Bank Selection Failed\n\r");
+					PMU_SCOPE_END(PMU_SCOPE_QSPI_ACCESS);
 					return XST_FAILURE;
 				}
 
@@ -779,7 +820,18 @@ u32 QspiAccess( u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 			/*
 			 * Moving the data from local buffer to DDR destination address
 			 */
-			memcpy(BufferPtr, &ReadBuffer[DATA_OFFSET + gu8_qspi_dummy_byte], Length);
+			Status = DmaCopyAsync(
+					(u32)&ReadBuffer[DATA_OFFSET + gu8_qspi_dummy_byte],
+					(u32)BufferPtr, Length);
+			if (Status == XST_SUCCESS) {
+				Status = DmaWait();
+			}
+			if (Status != XST_SUCCESS) {
+				fsbl_printf(DEBUG_INFO,"QspiAccess: DMA failed, CPU copy\r\n");
+				memcpy(BufferPtr,
+						&ReadBuffer[DATA_OFFSET + gu8_qspi_dummy_byte],
+						Length);
+			}
 
 			/*
 			 * Updated the variables
@@ -804,6 +856,7 @@ u32 QspiAccess( u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 		Status = SendBankSelect(0);
 		if (Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_INFO, "Bank Selection Reset Failed\n\r");
+			PMU_SCOPE_END(PMU_SCOPE_QSPI_ACCESS);
 			return XST_FAILURE;
 		}
 
@@ -824,9 +877,207 @@ u32 QspiAccess( u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 		}
 	}
 
+	PMU_SCOPE_END(PMU_SCOPE_QSPI_ACCESS);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function is the vectored form of QspiAccess, the segments are merged
+* into as few device reads as possible
+*
+* @param	Segments is the list of segments, it is sorted in place
+* @param	Count is the number of segments
+*
+* @return
+*		- XST_SUCCESS if all the segments were read
+*		- XST_FAILURE otherwise
+*
+* @note		None
+*
+****************************************************************************/
+u32 QspiAccessV(MoveSegment *Segments, u32 Count)
+{
+	return MoveImageVector(Segments, Count, QspiAccess, QSPI_MOVE_V_GAP);
+}
+
+/******************************************************************************/
+/**
+*
+* This function erases the flash sector at Address and programs Length
+* bytes from Data at its start, then reads them back. It only supports a
+* single flash connection, a page aligned Address below 16 MB and a
+* Length up to a page. Linear mode is left for the write and set again
+* afterwards.
+*
+* @param	Address is the flash address, at the start of an erase sector
+* @param	Data is the data to program
+* @param	Length is the number of bytes to program
+*
+* @return
+*		- XST_SUCCESS if the data was programmed and read back
+*		- XST_FAILURE otherwise
+*
+* @note		The rest of the sector is erased
+*
+****************************************************************************/
+u32 QspiFlashWrite(u32 Address, const u8 *Data, u32 Length)
+{
+	u32 Status;
+
+	if ((XPAR_PS7_QSPI_0_QSPI_MODE != SINGLE_FLASH_CONNECTION) ||
+			((Address % FLASH_SECTOR_SIZE) != 0) ||
+			(Length == 0) || (Length > FLASH_PAGE_SIZE) ||
+			((Address + Length) > FLASH_SIZE_16MB)) {
+		fsbl_printf(DEBUG_GENERAL, "QSPI write not supported at 0x%08x\r\n",
+				Address);
+		return XST_FAILURE;
+	}
+
+	if (LinearBootDeviceFlag == 1) {
+		FlashIoMode();
+	} else {
+		Status = SendBankSelect(0);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	/*
+	 * Erase the sector
+	 */
+	Status = FlashWriteEnable();
+	if (Status == XST_SUCCESS) {
+		WriteBuffer[COMMAND_OFFSET]   = SECTOR_ERASE_CMD;
+		WriteBuffer[ADDRESS_1_OFFSET] = (u8)((Address & 0xFF0000) >> 16);
+		WriteBuffer[ADDRESS_2_OFFSET] = (u8)((Address & 0xFF00) >> 8);
+		WriteBuffer[ADDRESS_3_OFFSET] = (u8)(Address & 0xFF);
+		Status = XQspiPs_PolledTransfer(QspiInstancePtr, WriteBuffer, NULL,
+				SECTOR_ERASE_SIZE);
+	}
+	if (Status == XST_SUCCESS) {
+		Status = FlashWaitReady();
+	}
+
+	/*
+	 * Program the page, command and data are sent from ReadBuffer
+	 */
+	if (Status == XST_SUCCESS) {
+		Status = FlashWriteEnable();
+	}
+	if (Status == XST_SUCCESS) {
+		ReadBuffer[COMMAND_OFFSET]   = PAGE_PROGRAM_CMD;
+		ReadBuffer[ADDRESS_1_OFFSET] = (u8)((Address & 0xFF0000) >> 16);
+		ReadBuffer[ADDRESS_2_OFFSET] = (u8)((Address & 0xFF00) >> 8);
+		ReadBuffer[ADDRESS_3_OFFSET] = (u8)(Address & 0xFF);
+		memcpy(&ReadBuffer[DATA_OFFSET], Data, Length);
+		Status = XQspiPs_PolledTransfer(QspiInstancePtr, ReadBuffer, NULL,
+				Length + OVERHEAD_SIZE);
+	}
+	if (Status == XST_SUCCESS) {
+		Status = FlashWaitReady();
+	}
+
+	/*
+	 * Read back
+	 */
+	if (Status == XST_SUCCESS) {
+		FlashRead(Address, Length);
+		if (memcmp(&ReadBuffer[DATA_OFFSET + gu8_qspi_dummy_byte], Data,
+				Length) != 0) {
+			Status = XST_FAILURE;
+		}
+	}
+
+	if (LinearBootDeviceFlag == 1) {
+		FlashLinearMode();
+		Xil_DCacheInvalidateRange(FlashReadBaseAddress + Address, Length);
+	}
+
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL, "QSPI write at 0x%08x failed\r\n",
+				Address);
+		return XST_FAILURE;
+	}
+
 	return XST_SUCCESS;
 }
 
+/******************************************************************************
+*
+* This function sends the write enable command to the flash
+*
+* @return	XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static u32 FlashWriteEnable(void)
+{
+	WriteBuffer[COMMAND_OFFSET] = WRITE_ENABLE_CMD;
+	return XQspiPs_PolledTransfer(QspiInstancePtr, WriteBuffer, NULL,
+			WRITE_ENABLE_CMD_SIZE);
+}
+
+/******************************************************************************
+*
+* This function polls the flash status register until the erase or program
+* in progress is done
+*
+* @return	XST_SUCCESS when done, XST_FAILURE on a timeout
+*
+******************************************************************************/
+static u32 FlashWaitReady(void)
+{
+	PollDeadline Poll;
+	u32 Status;
+
+	PollStart(&Poll, POLL_SITE_QSPI_WRITE);
+	do {
+		WriteBuffer[COMMAND_OFFSET] = READ_STATUS_CMD;
+		Status = XQspiPs_PolledTransfer(QspiInstancePtr, WriteBuffer,
+				ReadBuffer, READ_STATUS_SIZE);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		if ((ReadBuffer[1] & FLASH_SR_WIP_MASK) == 0) {
+			break;
+		}
+		if (PollExpired(&Poll)) {
+			Status = XST_FAILURE;
+			break;
+		}
+	} while (1);
+	PollEnd(&Poll);
+
+	return Status;
+}
+
+/******************************************************************************
+*
+* These functions switch a single flash connection between the linear mode
+* InitQspi sets up and the I/O mode used for the flash commands
+*
+******************************************************************************/
+static void FlashIoMode(void)
+{
+	XQspiPs_Disable(QspiInstancePtr);
+	XQspiPs_SetOptions(QspiInstancePtr, XQSPIPS_FORCE_SSELECT_OPTION |
+			XQSPIPS_HOLD_B_DRIVE_OPTION);
+	XQspiPs_SetLqspiConfigReg(QspiInstancePtr, SINGLE_QSPI_IO_CONFIG_QUAD_READ);
+	XQspiPs_Enable(QspiInstancePtr);
+	XQspiPs_SetSlaveSelect(QspiInstancePtr);
+}
+
+static void FlashLinearMode(void)
+{
+	XQspiPs_Disable(QspiInstancePtr);
+	XQspiPs_SetOptions(QspiInstancePtr, XQSPIPS_LQSPI_MODE_OPTION |
+			XQSPIPS_HOLD_B_DRIVE_OPTION);
+	XQspiPs_SetLqspiConfigReg(QspiInstancePtr, SINGLE_QSPI_CONFIG_QUAD_READ);
+	XQspiPs_Enable(QspiInstancePtr);
+}
+
 
 
 /******************************************************************************
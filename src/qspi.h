@@ -45,6 +45,8 @@
 * 3.00a mb  01/09/12 Added the Delay Values defines for qspi
 * 5.00a sgd	05/17/13 Added Flash Size > 128Mbit support
 * 					 Dual Stack support
+* 12.00a hx 10/18/26 Added QspiAccessV
+*                    Added QspiFlashWrite
 * </pre>
 *
 * @note
@@ -60,6 +62,7 @@ extern "C" {
 
 /***************************** Include Files *********************************/
 #include "fsbl.h"
+#include "image_mover.h"
 
 /************************** Constant Definitions *****************************/
 #define SINGLE_FLASH_CONNECTION			0
@@ -110,6 +113,9 @@ u32 QspiAccess( u32 SourceAddress,
 		u32 DestinationAddress,
 		u32 LengthBytes);
 
+u32 QspiAccessV(MoveSegment *Segments, u32 Count);
+u32 QspiFlashWrite(u32 Address, const u8 *Data, u32 Length);
+
 u32 FlashReadID(void);
 u32 SendBankSelect(u8 BankSel);
 /************************** Variable Definitions *****************************/
@@ -64,6 +64,7 @@
 #include "fsbl.h"
 #include "rsa.h"
 #include "xilrsa.h"
+#include "fsbl_pmu.h"
 
 #ifdef	XPAR_XWDTPS_0_BASEADDR
 #include "xwdtps.h"
@@ -237,9 +238,11 @@ u32 AuthenticatePartition(u8 *Buffer, u32 Size)
 	/*
 	 * Calculate Hash Signature
 	 */
+	PMU_SCOPE_BEGIN(PMU_SCOPE_SHA256);
 	sha_256((u8 *)SignaturePtr, (RSA_SPK_MODULAR_EXT_SIZE +
 				RSA_SPK_EXPO_SIZE + RSA_SPK_MODULAR_SIZE),
 				HashSignature);
+	PMU_SCOPE_END(PMU_SCOPE_SHA256);
 	FsblPrintArray(HashSignature, 32, "SPK Hash Calculated");
 
    	/*
@@ -255,11 +258,13 @@ u32 AuthenticatePartition(u8 *Buffer, u32 Size)
 	/*
 	 * Decrypt SPK Signature
 	 */
+	PMU_SCOPE_BEGIN(PMU_SCOPE_RSA_PUBEXP);
 	rsa2048_pubexp((RSA_NUMBER)DecryptSignature,
 			(RSA_NUMBER)SignaturePtr,
 			(u32)PpkExp,
 			(RSA_NUMBER)PpkModular,
 			(RSA_NUMBER)PpkModularEx);
+	PMU_SCOPE_END(PMU_SCOPE_RSA_PUBEXP);
 	FsblPrintArray(DecryptSignature, RSA_SPK_SIGNATURE_SIZE,
 					"SPK Decrypted Hash");
 
@@ -275,11 +280,13 @@ u32 AuthenticatePartition(u8 *Buffer, u32 Size)
 	/*
 	 * Decrypt Partition Signature
 	 */
+	PMU_SCOPE_BEGIN(PMU_SCOPE_RSA_PUBEXP);
 	rsa2048_pubexp((RSA_NUMBER)DecryptSignature,
 			(RSA_NUMBER)SignaturePtr,
 			(u32)SpkExp,
 			(RSA_NUMBER)SpkModular,
 			(RSA_NUMBER)SpkModularEx);
+	PMU_SCOPE_END(PMU_SCOPE_RSA_PUBEXP);
 	FsblPrintArray(DecryptSignature, RSA_PARTITION_SIGNATURE_SIZE,
 					"Partition Decrypted Hash");
 
@@ -287,9 +294,11 @@ u32 AuthenticatePartition(u8 *Buffer, u32 Size)
 	 * Partition Authentication
 	 * Calculate Hash Signature
 	 */
+	PMU_SCOPE_BEGIN(PMU_SCOPE_SHA256);
 	sha_256((u8 *)Buffer,
 			(Size - RSA_PARTITION_SIGNATURE_SIZE),
 			HashSignature);
+	PMU_SCOPE_END(PMU_SCOPE_SHA256);
 	FsblPrintArray(HashSignature, 32,
 						"Partition Hash Calculated");
 
@@ -43,6 +43,13 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00a jz	04/28/11 Initial release
 * 7.00a kc  10/18/13 Integrated SD/MMC driver
+* 12.00a hx 10/18/26 Read with the data cache off for FSBL_CACHED_LOAD
+*                    Fast seek link map and a cache for the short reads
+*                    Bus negotiation with FSBL_SD_HIGH_SPEED
+*                    Raw LBA boot image with FSBL_SD_RAW_LBA
+*                    ADMA2 reads of the sector runs with FSBL_SD_ADMA
+*                    Added SDAccessV
+*                    Asynchronous moves with ADMA2, SDAccessStep
 *
 * </pre>
 *
@@ -60,18 +67,63 @@
 #define XPAR_PS7_SD_0_S_AXI_BASEADDR XPAR_XSDPS_0_BASEADDR
 #endif
 
+#include <string.h>
 #include "xstatus.h"
 
 #include "ff.h"
+#include "diskio.h"
 #include "sd.h"
+#include "sd_bus.h"
+#include "sd_dma.h"
+#include "fsbl_pmu.h"
+#include "fsbl_cache.h"
 
 /************************** Constant Definitions *****************************/
+#define SD_SECTOR_SIZE		512
+
+/*
+ * Gap in bytes SDAccessV reads through, a sector is read as a whole
+ */
+#define SD_MOVE_V_GAP		SD_SECTOR_SIZE
+
+/*
+ * Raw boot header, "XRAW", and the sectors moved by one raw read
+ */
+#define SD_RAW_MAGIC		0x57415258
+#define SD_RAW_READ_SECTORS	128
 
 /**************************** Type Definitions *******************************/
+#ifdef FSBL_SD_RAW_LBA
+/*
+ * Raw boot header at SD_RAW_HEADER_OFFSET in LBA 0. Checksum is the
+ * complement of the sum of the other words
+ */
+typedef struct {
+	u32 Magic;
+	u32 Lba;
+	u32 Sectors;
+	u32 Checksum;
+} SdRawHeader;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static u32 SDRead(u32 SourceAddress, void *Buffer, u32 LengthBytes,
+		UINT *BytesRead);
+static u32 SDFileRead(u32 SourceAddress, void *Buffer, u32 LengthBytes,
+		UINT *BytesRead);
+#ifdef FSBL_SD_ADMA
+static void SDDmaSetup(void);
+static u32 SDDmaRead(u32 SourceAddress, void *Buffer, u32 LengthBytes,
+		UINT *BytesRead);
+static u32 SDSector(u32 Offset, u32 *Run);
+#endif
+#ifdef FSBL_SD_RAW_LBA
+static u32 SDRawInit(void);
+static u32 SDRawRead(u32 SourceAddress, void *Buffer, u32 LengthBytes,
+		UINT *BytesRead);
+#endif
 
 /************************** Variable Definitions *****************************/
 
@@ -83,6 +135,41 @@ static FATFS fatfs;
 static char buffer[32];
 static char *boot_file = buffer;
 
+/*
+ * Cache of the short reads, SdCacheLength is 0 when empty
+ */
+static u8 SdCache[SD_CACHE_SIZE] __attribute__ ((aligned(32)));
+static u32 SdCacheStart;
+static u32 SdCacheLength;
+
+#if _USE_FASTSEEK
+static DWORD SdLinkMap[SD_LINKMAP_ENTRIES];
+#endif
+
+#ifdef FSBL_SD_RAW_LBA
+/*
+ * Location of BOOT.BIN when it is read without FatFs, SdRaw is 0 on the
+ * FAT path
+ */
+static u32 SdRaw;
+static u32 SdRawLba;
+static u32 SdRawSectors;
+static u32 SdRawSector[SD_SECTOR_SIZE / 4] __attribute__ ((aligned(32)));
+#endif
+
+#ifdef FSBL_SD_ADMA
+/*
+ * Set when the long reads are done with ADMA2
+ */
+static u32 SdDmaReady;
+
+/*
+ * ADMA2 read started by SDAccessStep and not yet seen complete
+ */
+static u32 SdStepDestination;
+static u32 SdStepBytes;
+#endif
+
 /******************************************************************************/
 /******************************************************************************/
 /**
@@ -95,7 +182,11 @@ static char *boot_file = buffer;
 *		- XST_SUCCESS if the controller initializes correctly
 *		- XST_FAILURE if the controller fails to initializes correctly
 *
-* @note		None.
+* @note		With _USE_FASTSEEK in the xilffs configuration the cluster chain
+*		of the file is mapped once here, so the seeks do not walk the FAT.
+*		With FSBL_SD_RAW_LBA the raw image is looked for first and the
+*		file is opened only if there is none. With FSBL_SD_ADMA the
+*		ADMA2 reads are set up last.
 *
 ****************************************************************************/
 u32 InitSD(const char *filename)
@@ -103,6 +194,18 @@ u32 InitSD(const char *filename)
 
 	FRESULT rc;
 
+	SdCacheLength = 0;
+
+#ifdef FSBL_SD_RAW_LBA
+	if (SDRawInit() == XST_SUCCESS) {
+		FlashReadBaseAddress = XPAR_PS7_SD_0_S_AXI_BASEADDR;
+#ifdef FSBL_SD_ADMA
+		SDDmaSetup();
+#endif
+		return XST_SUCCESS;
+	}
+#endif
+
 	/* Register volume work area, initialize device */
 	rc = f_mount(0, &fatfs);
 	fsbl_printf(DEBUG_INFO,"SD: rc= %.8x\n\r", rc);
@@ -121,6 +224,32 @@ u32 InitSD(const char *filename)
 		return XST_FAILURE;
 	}
 
+	/*
+	 * Faster bus before anything else is read
+	 */
+	if (SdBusTune() != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+#if _USE_FASTSEEK
+	/*
+	 * Map the cluster chain, seeks fall back to the FAT walk if the file
+	 * has more fragments than the map holds
+	 */
+	SdLinkMap[0] = SD_LINKMAP_ENTRIES;
+	fil.cltbl = SdLinkMap;
+	rc = f_lseek(&fil, CREATE_LINKMAP);
+	if (rc != FR_OK) {
+		fsbl_printf(DEBUG_INFO,"SD: No link map, %d entries needed\r\n",
+				SdLinkMap[0]);
+		fil.cltbl = NULL;
+	}
+#endif
+
+#ifdef FSBL_SD_ADMA
+	SDDmaSetup();
+#endif
+
 	return XST_SUCCESS;
 
 }
@@ -139,31 +268,606 @@ u32 InitSD(const char *filename)
 *		- XST_SUCCESS if the write completes correctly
 *		- XST_FAILURE if the write fails to completes correctly
 *
-* @note		None.
+* @note		Short reads are copied from the cache, which is filled with one
+*		SD_CACHE_SIZE read around them. The longer ones are read by FatFs
+*		straight into the destination, whole sectors as multi block reads.
 *
 ****************************************************************************/
 u32 SDAccess( u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 {
 
-	FRESULT rc;	 /* Result code */
 	UINT br;
+	u32 Start;
+	u32 Status;
+
+	PMU_SCOPE_BEGIN(PMU_SCOPE_SD_ACCESS);
+
+	if ((LengthBytes <= SD_CACHE_READ_MAX) &&
+			((SourceAddress < SdCacheStart) ||
+			((SourceAddress + LengthBytes) >
+					(SdCacheStart + SdCacheLength)))) {
+		/*
+		 * Refill the cache from the sector holding the read
+		 */
+		Start = SourceAddress & ~(SD_SECTOR_SIZE - 1);
+		SdCacheLength = 0;
+		Status = SDRead(Start, SdCache, SD_CACHE_SIZE, &br);
+		if (Status != XST_SUCCESS) {
+			PMU_SCOPE_END(PMU_SCOPE_SD_ACCESS);
+			return XST_FAILURE;
+		}
+		SdCacheStart = Start;
+		SdCacheLength = br;
+	}
 
-	rc = f_lseek(&fil, SourceAddress);
-	if (rc) {
-		fsbl_printf(DEBUG_INFO,"SD: Unable to seek to %x\n", SourceAddress);
-		return XST_FAILURE;
+	if ((LengthBytes <= SD_CACHE_READ_MAX) &&
+			((SourceAddress + LengthBytes) <=
+					(SdCacheStart + SdCacheLength))) {
+		memcpy((void *)DestinationAddress,
+				&SdCache[SourceAddress - SdCacheStart], LengthBytes);
+		PMU_SCOPE_END(PMU_SCOPE_SD_ACCESS);
+		return XST_SUCCESS;
+	}
+
+	/*
+	 * Long read, or a short one past the end of the file
+	 */
+	Status = SDRead(SourceAddress, (void *)DestinationAddress, LengthBytes,
+			&br);
+
+	PMU_SCOPE_END(PMU_SCOPE_SD_ACCESS);
+
+	return Status;
+
+} /* End of SDAccess */
+
+/******************************************************************************/
+/**
+*
+* This function is the vectored form of SDAccess, the segments are merged
+* into as few device reads as possible
+*
+* @param	Segments is the list of segments, it is sorted in place
+* @param	Count is the number of segments
+*
+* @return
+*		- XST_SUCCESS if all the segments were read
+*		- XST_FAILURE otherwise
+*
+* @note		None
+*
+****************************************************************************/
+u32 SDAccessV(MoveSegment *Segments, u32 Count)
+{
+	return MoveImageVector(Segments, Count, SDAccess, SD_MOVE_V_GAP);
+}
+
+#ifdef FSBL_SD_ADMA
+/******************************************************************************/
+/**
+*
+* This function advances an asynchronous move. Each run of consecutive
+* sectors is started as an ADMA2 read and the function returns while it is
+* running, the partial sectors are read with SDAccess.
+*
+* @param	Request is the move
+*
+* @return
+*		- XST_DEVICE_BUSY while a read is running
+*		- XST_SUCCESS once the whole move is done
+*		- XST_FAILURE if a read fails
+*
+* @note		The destination of a running read is written back from the
+*		cache before the read and dropped from it afterwards, the CPU
+*		must not touch it in between.
+*
+****************************************************************************/
+u32 SDAccessStep(MoveRequest *Request)
+{
+	u32 Source;
+	u32 Destination;
+	u32 Remaining;
+	u32 Length;
+	u32 Sector;
+	u32 Run;
+	u32 Status;
+
+	if (SdStepBytes != 0) {
+		Status = SdDmaPoll();
+		if (Status == XST_DEVICE_BUSY) {
+			return XST_DEVICE_BUSY;
+		}
+		CacheInvalidateRange(SdStepDestination, SdStepBytes);
+		Request->Moved += SdStepBytes;
+		SdStepBytes = 0;
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	while (Request->Moved < Request->LengthBytes) {
+		Source = Request->SourceAddress + Request->Moved;
+		Destination = Request->DestinationAddress + Request->Moved;
+		Remaining = Request->LengthBytes - Request->Moved;
+
+		/*
+		 * Bytes up to the next sector boundary
+		 */
+		Length = (SD_SECTOR_SIZE - (Source % SD_SECTOR_SIZE)) %
+				SD_SECTOR_SIZE;
+
+		if ((Length == 0) && SdDmaReady && ((Destination & 0x3) == 0)) {
+			Sector = SDSector(Source, &Run);
+			if (Run > (Remaining / SD_SECTOR_SIZE)) {
+				Run = Remaining / SD_SECTOR_SIZE;
+			}
+			if (Run > SD_DMA_MAX_SECTORS) {
+				Run = SD_DMA_MAX_SECTORS;
+			}
+			if (Run != 0) {
+				Length = Run * SD_SECTOR_SIZE;
+				CacheCleanRange(Destination, Length);
+				Status = SdDmaRead(Sector, Destination, Run);
+				if (Status != XST_SUCCESS) {
+					return XST_FAILURE;
+				}
+				SdStepDestination = Destination;
+				SdStepBytes = Length;
+				return XST_DEVICE_BUSY;
+			}
+		}
+
+		/*
+		 * The rest is read in one go when it cannot continue with ADMA2
+		 */
+		if ((Length == 0) || (Length > Remaining) || !SdDmaReady ||
+				(((Destination + Length) & 0x3) != 0)) {
+			Length = Remaining;
+		}
+
+		Status = SDAccess(Source, Destination, Length);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		Request->Moved += Length;
+	}
+
+	return XST_SUCCESS;
+}
+#endif
+
+
+/******************************************************************************/
+/**
+*
+* This function reads from the file at an offset
+*
+* @param	SourceAddress is the offset in the file
+* @param	Buffer is the destination
+* @param	LengthBytes is the number of bytes to read
+* @param	BytesRead is set to the number of bytes read
+*
+* @return
+*		- XST_SUCCESS if the read completes correctly
+*		- XST_FAILURE if the read fails
+*
+* @note		Reads of at least SD_DMA_MIN_BYTES are done with ADMA2 once
+*		SDDmaSetup succeeded.
+*
+****************************************************************************/
+static u32 SDRead(u32 SourceAddress, void *Buffer, u32 LengthBytes,
+		UINT *BytesRead)
+{
+#ifdef FSBL_SD_ADMA
+	if (SdDmaReady && (LengthBytes >= SD_DMA_MIN_BYTES)) {
+		return SDDmaRead(SourceAddress, Buffer, LengthBytes, BytesRead);
 	}
+#endif
 
-	rc = f_read(&fil, (void*)DestinationAddress, LengthBytes, &br);
+	return SDFileRead(SourceAddress, Buffer, LengthBytes, BytesRead);
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads from the file at an offset through the driver, with
+* FatFs or from the raw image
+*
+* @param	SourceAddress is the offset in the file
+* @param	Buffer is the destination
+* @param	LengthBytes is the number of bytes to read
+* @param	BytesRead is set to the number of bytes read
+*
+* @return
+*		- XST_SUCCESS if the read completes correctly
+*		- XST_FAILURE if the seek or the read fails
+*
+* @note		The seek is skipped when the file is already at the offset, as
+*		it is for sequential reads
+*
+****************************************************************************/
+static u32 SDFileRead(u32 SourceAddress, void *Buffer, u32 LengthBytes,
+		UINT *BytesRead)
+{
+	FRESULT rc;
+	u32 CacheState;
+
+#ifdef FSBL_SD_RAW_LBA
+	if (SdRaw) {
+		return SDRawRead(SourceAddress, Buffer, LengthBytes, BytesRead);
+	}
+#endif
+
+	if (fil.fptr != SourceAddress) {
+		rc = f_lseek(&fil, SourceAddress);
+		if (rc) {
+			fsbl_printf(DEBUG_INFO,"SD: Unable to seek to %x\n", SourceAddress);
+			return XST_FAILURE;
+		}
+	}
+
+	/*
+	 * The SD host DMA and the FatFs window buffer are not cache aware,
+	 * so the read is done with the cache off
+	 */
+	CacheState = CacheLoadSuspend();
+	rc = f_read(&fil, Buffer, LengthBytes, BytesRead);
+	CacheLoadResume(CacheState);
 
 	if (rc) {
 		fsbl_printf(DEBUG_GENERAL,"*** ERROR: f_read returned %d\r\n", rc);
+		return XST_FAILURE;
 	}
 
 	return XST_SUCCESS;
+}
 
-} /* End of SDAccess */
+#ifdef FSBL_SD_ADMA
+/******************************************************************************/
+/**
+*
+* This function turns the ADMA2 reads on if the card reads the first sector
+* of the image correctly with them
+*
+* @param	None
+*
+* @return	None
+*
+* @note		On the FAT path the sectors are found with the link map, so
+*		the ADMA2 reads need _USE_FASTSEEK.
+*
+****************************************************************************/
+static void SDDmaSetup(void)
+{
+	u32 Sector;
+	u32 Run;
+
+	SdDmaReady = 0;
+
+	Sector = SDSector(0, &Run);
+	if ((Run != 0) && (SdDmaInit(Sector) == XST_SUCCESS)) {
+		SdDmaReady = 1;
+	} else {
+		fsbl_printf(DEBUG_INFO,"SD: ADMA2 reads not used\r\n");
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads from the file at an offset with ADMA2. Each run of
+* consecutive sectors is read with one command straight into the
+* destination.
+*
+* @param	SourceAddress is the offset in the file
+* @param	Buffer is the destination
+* @param	LengthBytes is the number of bytes to read
+* @param	BytesRead is set to the number of bytes read
+*
+* @return
+*		- XST_SUCCESS if the read completes correctly
+*		- XST_FAILURE if a read fails
+*
+* @note		The partial sectors, the last partial sector of the file and
+*		unaligned destinations are read by SDFileRead.
+*
+****************************************************************************/
+static u32 SDDmaRead(u32 SourceAddress, void *Buffer, u32 LengthBytes,
+		UINT *BytesRead)
+{
+	u8 *Destination = (u8 *)Buffer;
+	u32 Size;
+	u32 Sector;
+	u32 Run;
+	u32 CacheState;
+	UINT br = 0;
+	u32 Status = XST_SUCCESS;
+
+	*BytesRead = 0;
+
+	Size = (SD_SECTOR_SIZE - (SourceAddress % SD_SECTOR_SIZE)) %
+			SD_SECTOR_SIZE;
+	if (((u32)(Destination + Size) & 0x3) != 0) {
+		Size = LengthBytes;
+	}
+	if (Size != 0) {
+		Status = SDFileRead(SourceAddress, Destination, Size, &br);
+		*BytesRead += br;
+		if ((Status != XST_SUCCESS) || (br != Size)) {
+			return Status;
+		}
+		SourceAddress += Size;
+		Destination += Size;
+		LengthBytes -= Size;
+	}
+
+	/*
+	 * The SD host DMA is not cache aware
+	 */
+	CacheState = CacheLoadSuspend();
+
+	while (LengthBytes >= SD_SECTOR_SIZE) {
+		Sector = SDSector(SourceAddress, &Run);
+		if (Run == 0) {
+			break;
+		}
+		if (Run > (LengthBytes / SD_SECTOR_SIZE)) {
+			Run = LengthBytes / SD_SECTOR_SIZE;
+		}
+		if (Run > SD_DMA_MAX_SECTORS) {
+			Run = SD_DMA_MAX_SECTORS;
+		}
+
+		Status = SdDmaRead(Sector, (u32)Destination, Run);
+		if (Status == XST_SUCCESS) {
+			Status = SdDmaWait();
+		}
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+
+		Size = Run * SD_SECTOR_SIZE;
+		SourceAddress += Size;
+		Destination += Size;
+		LengthBytes -= Size;
+		*BytesRead += Size;
+	}
 
+	CacheLoadResume(CacheState);
+
+	if ((Status == XST_SUCCESS) && (LengthBytes != 0)) {
+		Status = SDFileRead(SourceAddress, Destination, LengthBytes, &br);
+		*BytesRead += br;
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function finds the card sector holding a file offset and how many
+* whole sectors of the file follow it on the card
+*
+* @param	Offset is the offset in the file
+* @param	Run is set to the number of consecutive sectors, 0 if the
+*		offset is in the last partial sector, past the end or not mapped
+*
+* @return	The sector
+*
+* @note		The FAT path walks the cluster link map.
+*
+****************************************************************************/
+static u32 SDSector(u32 Offset, u32 *Run)
+{
+	u32 FileSector = Offset / SD_SECTOR_SIZE;
+	u32 Sector = 0;
+#if _USE_FASTSEEK
+	u32 FileSectors;
+	u32 Cluster;
+	DWORD *Map;
+#endif
+
+	*Run = 0;
+
+#ifdef FSBL_SD_RAW_LBA
+	if (SdRaw) {
+		if (FileSector < SdRawSectors) {
+			*Run = SdRawSectors - FileSector;
+			Sector = SdRawLba + FileSector;
+		}
+		return Sector;
+	}
+#endif
+
+#if _USE_FASTSEEK
+	FileSectors = fil.fsize / SD_SECTOR_SIZE;
+	if ((fil.cltbl == NULL) || (FileSector >= FileSectors)) {
+		return 0;
+	}
+
+	/*
+	 * The map holds the length and the first cluster of each fragment
+	 */
+	Cluster = FileSector / fatfs.csize;
+	Map = fil.cltbl + 1;
+	while ((Map[0] != 0) && (Cluster >= Map[0])) {
+		Cluster -= Map[0];
+		Map += 2;
+	}
+	if (Map[0] == 0) {
+		return 0;
+	}
+
+	Sector = fatfs.database + ((Map[1] + Cluster - 2) * fatfs.csize) +
+			(FileSector % fatfs.csize);
+	*Run = ((Map[0] - Cluster) * fatfs.csize) - (FileSector % fatfs.csize);
+	if (*Run > (FileSectors - FileSector)) {
+		*Run = FileSectors - FileSector;
+	}
+#endif
+
+	return Sector;
+}
+#endif
+
+#ifdef FSBL_SD_RAW_LBA
+/******************************************************************************/
+/**
+*
+* This function looks for a raw BOOT.BIN. It is described by the raw boot
+* header in LBA 0, or starts at SD_RAW_LBA when that is set and there is no
+* header. The first sector must carry the boot image identification.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the raw image is used
+*		- XST_FAILURE if there is none, the FAT path is then used
+*
+* @note		The card is initialized here, FatFs is not used.
+*
+****************************************************************************/
+static u32 SDRawInit(void)
+{
+	SdRawHeader *Header;
+	u32 CacheState;
+	DRESULT Result;
+
+	SdRaw = 0;
+
+	if (disk_initialize(0) & STA_NOINIT) {
+		fsbl_printf(DEBUG_GENERAL,"SD: Raw, card init failed\r\n");
+		return XST_FAILURE;
+	}
+
+	if (SdBusTune() != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	CacheState = CacheLoadSuspend();
+	Result = disk_read(0, (BYTE *)SdRawSector, 0, 1);
+	CacheLoadResume(CacheState);
+	if (Result != RES_OK) {
+		return XST_FAILURE;
+	}
+
+	Header = (SdRawHeader *)((u8 *)SdRawSector + SD_RAW_HEADER_OFFSET);
+	if ((Header->Magic == SD_RAW_MAGIC) && (Header->Sectors != 0) &&
+			(Header->Checksum ==
+				~(Header->Magic + Header->Lba + Header->Sectors))) {
+		SdRawLba = Header->Lba;
+		SdRawSectors = Header->Sectors;
+	} else {
+#ifdef SD_RAW_LBA
+		SdRawLba = SD_RAW_LBA;
+		SdRawSectors = 0xFFFFFFFF - SD_RAW_LBA;
+#else
+		fsbl_printf(DEBUG_INFO,"SD: No raw boot header\r\n");
+		return XST_FAILURE;
+#endif
+	}
+
+	CacheState = CacheLoadSuspend();
+	Result = disk_read(0, (BYTE *)SdRawSector, SdRawLba, 1);
+	CacheLoadResume(CacheState);
+	if ((Result != RES_OK) ||
+			(SdRawSector[IMAGE_IDENT_OFFSET / 4] != IMAGE_IDENT)) {
+		fsbl_printf(DEBUG_GENERAL,"SD: No boot image at LBA %x\r\n",
+				SdRawLba);
+		return XST_FAILURE;
+	}
+
+	fsbl_printf(DEBUG_INFO,"SD: Raw image at LBA %x, %x sectors\r\n",
+			SdRawLba, SdRawSectors);
+	SdRaw = 1;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads from the raw image at an offset, the reads stop at
+* the end of the image like the file reads do
+*
+* @param	SourceAddress is the offset in the image
+* @param	Buffer is the destination
+* @param	LengthBytes is the number of bytes to read
+* @param	BytesRead is set to the number of bytes read
+*
+* @return
+*		- XST_SUCCESS if the read completes correctly
+*		- XST_FAILURE if a sector read fails
+*
+* @note		Whole sectors are read by the driver straight into a word
+*		aligned destination, with its ADMA2 descriptors. The partial
+*		sectors and unaligned destinations go through SdRawSector.
+*
+****************************************************************************/
+static u32 SDRawRead(u32 SourceAddress, void *Buffer, u32 LengthBytes,
+		UINT *BytesRead)
+{
+	u8 *Destination = (u8 *)Buffer;
+	u32 Sector = SourceAddress / SD_SECTOR_SIZE;
+	u32 Offset = SourceAddress % SD_SECTOR_SIZE;
+	u32 Remaining;
+	u32 Count;
+	u32 Size;
+	u32 CacheState;
+	DRESULT Result = RES_OK;
+
+	*BytesRead = 0;
+	if (Sector >= SdRawSectors) {
+		return XST_SUCCESS;
+	}
+	Remaining = SdRawSectors - Sector;
+	if (Remaining <= ((Offset + LengthBytes) / SD_SECTOR_SIZE)) {
+		LengthBytes = (Remaining * SD_SECTOR_SIZE) - Offset;
+	}
+
+	/*
+	 * The SD host DMA is not cache aware
+	 */
+	CacheState = CacheLoadSuspend();
+
+	while ((LengthBytes != 0) && (Result == RES_OK)) {
+		if ((Offset != 0) || (LengthBytes < SD_SECTOR_SIZE) ||
+				(((u32)Destination & 0x3) != 0)) {
+			Size = SD_SECTOR_SIZE - Offset;
+			if (Size > LengthBytes) {
+				Size = LengthBytes;
+			}
+			Result = disk_read(0, (BYTE *)SdRawSector,
+					SdRawLba + Sector, 1);
+			memcpy(Destination, (u8 *)SdRawSector + Offset, Size);
+			Count = 1;
+			Offset = 0;
+		} else {
+			Count = LengthBytes / SD_SECTOR_SIZE;
+			if (Count > SD_RAW_READ_SECTORS) {
+				Count = SD_RAW_READ_SECTORS;
+			}
+			Size = Count * SD_SECTOR_SIZE;
+			Result = disk_read(0, Destination, SdRawLba + Sector, Count);
+		}
+		Sector += Count;
+		Destination += Size;
+		LengthBytes -= Size;
+		*BytesRead += Size;
+	}
+
+	CacheLoadResume(CacheState);
+
+	if (Result != RES_OK) {
+		fsbl_printf(DEBUG_GENERAL,"*** ERROR: disk_read returned %d\r\n",
+				Result);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+#endif
 
 /******************************************************************************/
 /**
@@ -179,6 +883,11 @@ u32 SDAccess( u32 SourceAddress, u32 DestinationAddress, u32 LengthBytes)
 ****************************************************************************/
 void ReleaseSD(void) {
 
+#ifdef FSBL_SD_RAW_LBA
+	if (SdRaw) {
+		return;
+	}
+#endif
 	f_close(&fil);
 	return;
 
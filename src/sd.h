@@ -43,6 +43,11 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00a bh	03/10/11 Initial release
 * 7.00a kc  10/18/13 Integrated SD/MMC driver
+* 12.00a hx 10/18/26 Added SD_CACHE_SIZE, SD_CACHE_READ_MAX and
+*                    SD_LINKMAP_ENTRIES
+*                    Added SD_RAW_HEADER_OFFSET and SD_RAW_LBA
+*                    Added SDAccessV
+*                    Added SDAccessStep
 *
 * </pre>
 *
@@ -58,6 +63,43 @@ extern "C" {
 #endif
 
 
+/***************************** Include Files *********************************/
+#include "image_mover.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Reads of at most SD_CACHE_READ_MAX bytes are served from a cache of
+ * SD_CACHE_SIZE bytes of BOOT.BIN, filled with one read
+ */
+#ifndef SD_CACHE_SIZE
+#define SD_CACHE_SIZE			8192
+#endif
+#ifndef SD_CACHE_READ_MAX
+#define SD_CACHE_READ_MAX		1024
+#endif
+
+/*
+ * Size in DWORDs of the FatFs cluster link map of BOOT.BIN, two per
+ * fragment plus one
+ */
+#ifndef SD_LINKMAP_ENTRIES
+#define SD_LINKMAP_ENTRIES		64
+#endif
+
+/*
+ * FSBL_SD_RAW_LBA, offset in LBA 0 of the raw boot header, word aligned and
+ * below the partition table at 0x1BE
+ */
+#ifndef SD_RAW_HEADER_OFFSET
+#define SD_RAW_HEADER_OFFSET	0
+#endif
+
+/*
+ * FSBL_SD_RAW_LBA, sector of BOOT.BIN when LBA 0 has no raw boot header
+ */
+/* #define SD_RAW_LBA			0x800 */
+
 /************************** Function Prototypes ******************************/
 
 #if defined(XPAR_PS7_SD_0_S_AXI_BASEADDR) || defined(XPAR_XSDPS_0_BASEADDR)
@@ -67,6 +109,14 @@ u32 SDAccess( u32 SourceAddress,
 		u32 DestinationAddress,
 		u32 LengthWords);
 
+u32 SDAccessV(MoveSegment *Segments, u32 Count);
+
+#ifdef FSBL_SD_ADMA
+u32 SDAccessStep(MoveRequest *Request);
+#else
+#define SDAccessStep	NULL
+#endif
+
 void ReleaseSD(void);
 #endif
 /************************** Variable Definitions *****************************/
@@ -0,0 +1,652 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file sd_bus.c
+*
+* Contains the SD/eMMC bus negotiation done by InitSD when FSBL_SD_HIGH_SPEED
+* is set.
+*
+* The card is identified again from CMD0 so that its RCA is known, switched
+* to the 4 bit bus and to High Speed timing, and the SD clock is raised to
+* the highest rate the negotiated timing allows. Sector 0 is read through
+* the driver before and after and the two must match, otherwise the clock
+* and then the bus width are stepped back.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+* 1.01a hx	10/18/26	Controller registers moved to sd_hw.h
+*
+* </pre>
+*
+* @note
+*
+* The Zynq-7000 SD controller drives 4 data lines at 3.3V, so eMMC devices
+* are also run 4 bit wide, and High Speed (50 MHz SD, 52 MHz eMMC) is the
+* fastest timing it supports. The UHS-I and HS200 modes need the 1.8V
+* signalling and the tuning the controller does not have.
+*
+* The registers are accessed directly as the xilffs glue keeps the driver
+* instance to itself. The driver settings that are not touched here (DMA
+* select, interrupt enables, block size) are preserved.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xparameters.h"
+#include "fsbl.h"
+
+#if defined(XPAR_PS7_SD_0_S_AXI_BASEADDR) || defined(XPAR_XSDPS_0_BASEADDR)
+
+#ifndef XPAR_PS7_SD_0_S_AXI_BASEADDR
+#define XPAR_PS7_SD_0_S_AXI_BASEADDR XPAR_XSDPS_0_BASEADDR
+#endif
+
+#include "sd_bus.h"
+
+#ifdef FSBL_SD_HIGH_SPEED
+
+#include <string.h>
+#include "xil_io.h"
+#include "ff.h"
+#include "diskio.h"
+#include "fsbl_poll.h"
+#include "sd_hw.h"
+
+/************************** Constant Definitions *****************************/
+#define SD_CMD0					SD_CMD(0, SD_RESP_NONE)
+#define MMC_CMD1				SD_CMD(1, SD_RESP_R3)
+#define SD_CMD2					SD_CMD(2, SD_RESP_R2)
+#define SD_CMD3					SD_CMD(3, SD_RESP_R1)
+#define SD_CMD6					SD_CMD(6, SD_RESP_R1 | SD_CMD_DATA)
+#define SD_ACMD6				SD_CMD(6, SD_RESP_R1)
+#define MMC_CMD6				SD_CMD(6, SD_RESP_R1B)
+#define SD_CMD7					SD_CMD(7, SD_RESP_R1B)
+#define SD_CMD8					SD_CMD(8, SD_RESP_R1)
+#define SD_CMD13				SD_CMD(13, SD_RESP_R1)
+#define SD_CMD16				SD_CMD(16, SD_RESP_R1)
+#define SD_ACMD41				SD_CMD(41, SD_RESP_R3)
+#define SD_CMD55				SD_CMD(55, SD_RESP_R1)
+
+/*
+ * Card arguments and responses
+ */
+#define SD_CMD8_PATTERN			0x000001AA
+#define SD_CMD8_ECHO_MASK		0x00000FFF
+#define SD_OCR_VOLTAGE			0x00FF8000
+#define SD_OCR_HCS				0x40000000
+#define SD_OCR_READY			0x80000000
+#define MMC_OCR_VOLTAGE			0x00FF8080
+#define MMC_RCA					0x0001
+#define SD_ACMD6_4BIT			0x2
+#define SD_ACMD6_1BIT			0x0
+#define SD_SWITCH_HIGH_SPEED	0x80FFFFF1
+#define SD_SWITCH_STATUS_BYTES	64
+#define SD_SWITCH_GROUP1_BYTE	16
+#define SD_R1_SWITCH_ERROR		0x00000080
+#define MMC_SWITCH_WRITE_BYTE	(0x3 << 24)
+#define MMC_EXT_CSD_BUS_WIDTH	183
+#define MMC_EXT_CSD_HS_TIMING	185
+#define MMC_BUS_WIDTH_1BIT		0
+#define MMC_BUS_WIDTH_4BIT		1
+#define SD_BLOCK_SIZE			512
+
+/*
+ * SD clock of each stage
+ */
+#define SD_CLK_IDENT_HZ			400000
+#define SD_CLK_DEFAULT_HZ		25000000
+#define SD_CLK_HIGH_SPEED_HZ	50000000
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define SdHostCtrl(Set, Clear) \
+	Xil_Out8(SD_HW_BASEADDR + SD_HOST_CTRL_OFFSET, \
+		(Xil_In8(SD_HW_BASEADDR + SD_HOST_CTRL_OFFSET) & ~(Clear)) | (Set))
+
+/************************** Function Prototypes ******************************/
+static u32 SdIdentify(u32 *Mmc, u32 *Rca);
+static u32 SdSetWidth(u32 Mmc, u32 Rca, u32 Width);
+static u32 SdSwitchHighSpeed(u32 Mmc, u32 Rca);
+static u32 SdMmcSwitch(u32 Rca, u32 Index, u32 Value);
+static u32 SdCommand(u32 Cmd, u32 Arg, u32 Mode);
+static u32 SdWaitIntr(u32 Mask);
+static u32 SdSetClock(u32 Hz);
+static u32 SdVerify(void);
+
+/************************** Variable Definitions *****************************/
+
+/*
+ * Sector 0 read before the negotiation, and the test read after it
+ */
+static u32 SdRefSector[SD_BLOCK_SIZE / 4] __attribute__ ((aligned(32)));
+static u32 SdTestSector[SD_BLOCK_SIZE / 4] __attribute__ ((aligned(32)));
+
+/******************************************************************************/
+/**
+*
+* This function negotiates the bus width, the timing and the clock of the
+* card mounted by InitSD, and reports the resulting bandwidth.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the card reads back sector 0 with the new settings,
+*		  possibly stepped back to the default timing or to the 1 bit bus
+*		- XST_FAILURE if the card could not be identified again or no
+*		  setting reads it correctly
+*
+* @note		Called once the file system is mounted, the driver has then
+*		initialized the card.
+*
+****************************************************************************/
+u32 SdBusTune(void)
+{
+	u32 Mmc;
+	u32 Rca;
+	u32 Width = 1;
+	u32 HighSpeed = 0;
+	u32 Clock;
+	u32 Status;
+
+	if (disk_read(0, (BYTE *)SdRefSector, 0, 1) != RES_OK) {
+		fsbl_printf(DEBUG_GENERAL,"SD: Bus tune, read of sector 0 failed\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = SdIdentify(&Mmc, &Rca);
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"SD: Bus tune, identification failed\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = SdSetWidth(Mmc, Rca, 4);
+	if (Status == XST_SUCCESS) {
+		Width = 4;
+	}
+
+	Status = SdSwitchHighSpeed(Mmc, Rca);
+	if (Status == XST_SUCCESS) {
+		HighSpeed = 1;
+		SdHostCtrl(SD_HC_HIGH_SPEED, 0);
+		Clock = SdSetClock(SD_CLK_HIGH_SPEED_HZ);
+	} else {
+		Clock = SdSetClock(SD_CLK_DEFAULT_HZ);
+	}
+
+	Status = SdVerify();
+
+	if ((Status != XST_SUCCESS) && HighSpeed) {
+		/*
+		 * The card keeps the High Speed timing, it is also valid
+		 * at the default clock
+		 */
+		fsbl_printf(DEBUG_INFO,"SD: High Speed test read failed\r\n");
+		HighSpeed = 0;
+		SdHostCtrl(0, SD_HC_HIGH_SPEED);
+		Clock = SdSetClock(SD_CLK_DEFAULT_HZ);
+		Status = SdVerify();
+	}
+
+	if ((Status != XST_SUCCESS) && (Width == 4)) {
+		fsbl_printf(DEBUG_INFO,"SD: 4 bit test read failed\r\n");
+		Width = 1;
+		Status = SdSetWidth(Mmc, Rca, 1);
+		if (Status == XST_SUCCESS) {
+			Status = SdVerify();
+		}
+	}
+
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"SD: Bus tune, test read failed\r\n");
+		return XST_FAILURE;
+	}
+
+	fsbl_printf(DEBUG_GENERAL,"SD: %s %d bit%s, %d kHz, %d KB/s\r\n",
+			Mmc ? "eMMC" : "SD", Width, HighSpeed ? " High Speed" : "",
+			Clock / 1000, (Clock / 8000) * Width);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function identifies the card again from the idle state at the
+* identification clock, assigns its RCA and selects it. The card is left in
+* the transfer state on a 1 bit bus at the default clock.
+*
+* @param	Mmc is set to 1 for an eMMC device, 0 for a SD card
+* @param	Rca is set to the relative card address
+*
+* @return
+*		- XST_SUCCESS if the card is selected
+*		- XST_FAILURE otherwise
+*
+* @note		eMMC devices do not answer ACMD41, they are then initialized
+*		with CMD1.
+*
+****************************************************************************/
+static u32 SdIdentify(u32 *Mmc, u32 *Rca)
+{
+	PollDeadline Poll;
+	u32 Hcs = 0;
+	u32 Ocr = 0;
+	u32 Status;
+
+	SdHostCtrl(0, SD_HC_4BIT | SD_HC_HIGH_SPEED);
+	(void)SdSetClock(SD_CLK_IDENT_HZ);
+
+	Status = SdCommand(SD_CMD0, 0, 0);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Only version 2.00 cards echo the check pattern, older ones and
+	 * eMMC time out
+	 */
+	Status = SdCommand(SD_CMD8, SD_CMD8_PATTERN, 0);
+	if ((Status == XST_SUCCESS) &&
+			((Xil_In32(SD_HW_BASEADDR + SD_RESP0_OFFSET) &
+				SD_CMD8_ECHO_MASK) == SD_CMD8_PATTERN)) {
+		Hcs = SD_OCR_HCS;
+	}
+
+	*Mmc = 0;
+	PollStart(&Poll, POLL_SITE_SD_READY);
+	do {
+		Status = SdCommand(SD_CMD55, 0, 0);
+		if (Status == XST_SUCCESS) {
+			Status = SdCommand(SD_ACMD41, SD_OCR_VOLTAGE | Hcs, 0);
+		}
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		Ocr = Xil_In32(SD_HW_BASEADDR + SD_RESP0_OFFSET);
+	} while (((Ocr & SD_OCR_READY) == 0) && !PollExpired(&Poll));
+	PollEnd(&Poll);
+
+	if ((Status != XST_SUCCESS) && (Ocr == 0)) {
+		*Mmc = 1;
+		Status = SdCommand(SD_CMD0, 0, 0);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		PollStart(&Poll, POLL_SITE_SD_READY);
+		do {
+			Status = SdCommand(MMC_CMD1, MMC_OCR_VOLTAGE, 0);
+			if (Status != XST_SUCCESS) {
+				break;
+			}
+			Ocr = Xil_In32(SD_HW_BASEADDR + SD_RESP0_OFFSET);
+		} while (((Ocr & SD_OCR_READY) == 0) && !PollExpired(&Poll));
+		PollEnd(&Poll);
+	}
+
+	if ((Status != XST_SUCCESS) || ((Ocr & SD_OCR_READY) == 0)) {
+		return XST_FAILURE;
+	}
+
+	Status = SdCommand(SD_CMD2, 0, 0);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * SD cards publish their RCA, eMMC devices are given one
+	 */
+	if (*Mmc) {
+		*Rca = MMC_RCA;
+		Status = SdCommand(SD_CMD3, *Rca << 16, 0);
+	} else {
+		Status = SdCommand(SD_CMD3, 0, 0);
+		*Rca = Xil_In32(SD_HW_BASEADDR + SD_RESP0_OFFSET) >> 16;
+	}
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	(void)SdSetClock(SD_CLK_DEFAULT_HZ);
+
+	Status = SdCommand(SD_CMD7, *Rca << 16, 0);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Byte addressed cards reset the block length to 512 anyway, this
+	 * only makes it explicit
+	 */
+	return SdCommand(SD_CMD16, SD_BLOCK_SIZE, 0);
+}
+
+/******************************************************************************/
+/**
+*
+* This function sets the bus width of the card and of the controller
+*
+* @param	Mmc is 1 for an eMMC device
+* @param	Rca is the relative card address
+* @param	Width is 1 or 4
+*
+* @return
+*		- XST_SUCCESS if the card accepted the width
+*		- XST_FAILURE otherwise, the controller is left unchanged
+*
+* @note		None
+*
+****************************************************************************/
+static u32 SdSetWidth(u32 Mmc, u32 Rca, u32 Width)
+{
+	u32 Status;
+
+	if (Mmc) {
+		Status = SdMmcSwitch(Rca, MMC_EXT_CSD_BUS_WIDTH,
+				(Width == 4) ? MMC_BUS_WIDTH_4BIT : MMC_BUS_WIDTH_1BIT);
+	} else {
+		Status = SdCommand(SD_CMD55, Rca << 16, 0);
+		if (Status == XST_SUCCESS) {
+			Status = SdCommand(SD_ACMD6,
+				(Width == 4) ? SD_ACMD6_4BIT : SD_ACMD6_1BIT, 0);
+		}
+	}
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (Width == 4) {
+		SdHostCtrl(SD_HC_4BIT, 0);
+	} else {
+		SdHostCtrl(0, SD_HC_4BIT);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function switches the card to the High Speed timing. For a SD card
+* this is function 1 of group 1 of CMD6, the switch status returned on the
+* data lines tells whether the card took it.
+*
+* @param	Mmc is 1 for an eMMC device
+* @param	Rca is the relative card address
+*
+* @return
+*		- XST_SUCCESS if the card runs High Speed
+*		- XST_FAILURE if it does not support it or the switch failed
+*
+* @note		The block size register is restored for the driver.
+*
+****************************************************************************/
+static u32 SdSwitchHighSpeed(u32 Mmc, u32 Rca)
+{
+	u32 SwitchStatus[SD_SWITCH_STATUS_BYTES / 4];
+	u32 BlockSize;
+	u32 Index;
+	u32 Status;
+
+	if (Mmc) {
+		return SdMmcSwitch(Rca, MMC_EXT_CSD_HS_TIMING, 1);
+	}
+
+	BlockSize = Xil_In32(SD_HW_BASEADDR + SD_BLK_SIZE_OFFSET);
+	Xil_Out32(SD_HW_BASEADDR + SD_BLK_SIZE_OFFSET,
+			(1 << 16) | SD_SWITCH_STATUS_BYTES);
+
+	Status = SdCommand(SD_CMD6, SD_SWITCH_HIGH_SPEED,
+			SD_TM_READ | SD_TM_BLK_CNT_EN);
+	if (Status == XST_SUCCESS) {
+		Status = SdWaitIntr(SD_INTR_BRR);
+	}
+	if (Status == XST_SUCCESS) {
+		for (Index = 0; Index < (SD_SWITCH_STATUS_BYTES / 4); Index++) {
+			SwitchStatus[Index] =
+				Xil_In32(SD_HW_BASEADDR + SD_BUF_DATA_OFFSET);
+		}
+		Status = SdWaitIntr(SD_INTR_TC);
+	}
+
+	Xil_Out32(SD_HW_BASEADDR + SD_BLK_SIZE_OFFSET, BlockSize);
+
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * The status is sent MSB first, the function now selected in group 1
+	 * is the low nibble of byte 16
+	 */
+	if ((((u8 *)SwitchStatus)[SD_SWITCH_GROUP1_BYTE] & 0xF) != 1) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function writes one byte of the eMMC EXT_CSD with CMD6 and checks
+* the result with CMD13
+*
+* @param	Rca is the relative card address
+* @param	Index is the EXT_CSD byte
+* @param	Value is the value written
+*
+* @return
+*		- XST_SUCCESS if the device switched
+*		- XST_FAILURE otherwise
+*
+* @note		None
+*
+****************************************************************************/
+static u32 SdMmcSwitch(u32 Rca, u32 Index, u32 Value)
+{
+	u32 Status;
+
+	Status = SdCommand(MMC_CMD6,
+			MMC_SWITCH_WRITE_BYTE | (Index << 16) | (Value << 8), 0);
+	if (Status == XST_SUCCESS) {
+		Status = SdCommand(SD_CMD13, Rca << 16, 0);
+	}
+	if ((Status != XST_SUCCESS) ||
+			(Xil_In32(SD_HW_BASEADDR + SD_RESP0_OFFSET) &
+				SD_R1_SWITCH_ERROR)) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function sends a command and waits for its response, and for the end
+* of the busy signal of the R1b commands
+*
+* @param	Cmd is the command register value, SD_CMD(Index, Flags)
+* @param	Arg is the command argument
+* @param	Mode is the transfer mode register value of data commands
+*
+* @return
+*		- XST_SUCCESS if the command completed
+*		- XST_FAILURE on a timeout or an error, the CMD and DAT lines are
+*		  reset
+*
+* @note		The response is left in the response registers.
+*
+****************************************************************************/
+static u32 SdCommand(u32 Cmd, u32 Arg, u32 Mode)
+{
+	u32 Inhibit = SD_PSR_INHIBIT_CMD;
+	u32 Status;
+
+	if ((Cmd & SD_CMD_DATA) ||
+			((Cmd & SD_RESP_BUSY_MASK) == SD_RESP_BUSY_MASK)) {
+		Inhibit |= SD_PSR_INHIBIT_DAT;
+	}
+
+	Status = PollMask(POLL_SITE_SD_CMD,
+			SD_HW_BASEADDR + SD_PRES_STATE_OFFSET, Inhibit, 0);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Xil_Out32(SD_HW_BASEADDR + SD_INTR_STS_OFFSET, SD_INTR_ALL);
+	Xil_Out32(SD_HW_BASEADDR + SD_ARG_OFFSET, Arg);
+	Xil_Out32(SD_HW_BASEADDR + SD_XFER_MODE_OFFSET, (Cmd << 16) | Mode);
+
+	Status = SdWaitIntr(SD_INTR_CC);
+	if ((Status == XST_SUCCESS) &&
+			((Cmd & SD_RESP_BUSY_MASK) == SD_RESP_BUSY_MASK)) {
+		Status = SdWaitIntr(SD_INTR_TC);
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for a normal interrupt status bit
+*
+* @param	Mask is the status bit
+*
+* @return
+*		- XST_SUCCESS if the bit was set without an error
+*		- XST_FAILURE on a timeout or an error
+*
+* @note		None
+*
+****************************************************************************/
+static u32 SdWaitIntr(u32 Mask)
+{
+	PollDeadline Poll;
+	u32 IntrStatus;
+
+	PollStart(&Poll, POLL_SITE_SD_CMD);
+	do {
+		IntrStatus = Xil_In32(SD_HW_BASEADDR + SD_INTR_STS_OFFSET);
+	} while (((IntrStatus & (Mask | SD_INTR_ERR)) == 0) &&
+			!PollExpired(&Poll));
+	PollEnd(&Poll);
+
+	if (((IntrStatus & Mask) != 0) && ((IntrStatus & SD_INTR_ERR) == 0)) {
+		Xil_Out32(SD_HW_BASEADDR + SD_INTR_STS_OFFSET, Mask);
+		return XST_SUCCESS;
+	}
+
+	/*
+	 * A command the card does not answer ends here too
+	 */
+	Xil_Out32(SD_HW_BASEADDR + SD_INTR_STS_OFFSET, SD_INTR_ALL);
+	Xil_Out8(SD_HW_BASEADDR + SD_SW_RST_OFFSET, SD_SWRST_CMD_DAT);
+	(void)PollMask(POLL_SITE_SD_CMD, SD_HW_BASEADDR + SD_CLK_CTRL_OFFSET,
+			SD_SWRST_CMD_DAT_MASK, 0);
+
+	return XST_FAILURE;
+}
+
+/******************************************************************************/
+/**
+*
+* This function sets the SD clock to the fastest rate not above Hz. The
+* divider of this controller is a power of 2 from 1 to 256.
+*
+* @param	Hz is the highest SD clock wanted
+*
+* @return	The SD clock in Hz
+*
+* @note		None
+*
+****************************************************************************/
+static u32 SdSetClock(u32 Hz)
+{
+	u32 Divider = 1;
+
+	while (((SD_BUS_REF_CLK_HZ / Divider) > Hz) &&
+			(Divider < SD_CC_DIV_MAX)) {
+		Divider <<= 1;
+	}
+
+	Xil_Out16(SD_HW_BASEADDR + SD_CLK_CTRL_OFFSET,
+			((Divider >> 1) << SD_CC_DIV_SHIFT) | SD_CC_INT_CLK_EN);
+	(void)PollMask(POLL_SITE_SD_CMD, SD_HW_BASEADDR + SD_CLK_CTRL_OFFSET,
+			SD_CC_INT_CLK_STABLE, SD_CC_INT_CLK_STABLE);
+	Xil_Out16(SD_HW_BASEADDR + SD_CLK_CTRL_OFFSET,
+			Xil_In16(SD_HW_BASEADDR + SD_CLK_CTRL_OFFSET) |
+			SD_CC_SD_CLK_EN);
+
+	return SD_BUS_REF_CLK_HZ / Divider;
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads sector 0 through the driver and compares it with the
+* copy read before the negotiation
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if both match
+*		- XST_FAILURE otherwise
+*
+* @note		None
+*
+****************************************************************************/
+static u32 SdVerify(void)
+{
+	if (disk_read(0, (BYTE *)SdTestSector, 0, 1) != RES_OK) {
+		return XST_FAILURE;
+	}
+
+	if (memcmp(SdTestSector, SdRefSector, SD_BLOCK_SIZE) != 0) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+#endif /* FSBL_SD_HIGH_SPEED */
+
+#endif
@@ -0,0 +1,386 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file sd_dma.c
+*
+* Contains the ADMA2 reads of the SD/eMMC card used when FSBL_SD_ADMA is set.
+*
+* A read of a run of consecutive sectors is one CMD18 whose data the
+* controller writes straight to the destination, following a descriptor
+* chain of up to SD_DMA_DESC_COUNT 64 KB segments. SdDmaRead only starts the
+* transfer, the CPU is free until SdDmaWait.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+* 1.01a hx	10/18/26	Added SdDmaPoll, the deadline starts with the read
+*
+* </pre>
+*
+* @note
+*
+* The card must have been initialized by the driver. Whether it takes block
+* or byte addresses is found by SdDmaInit from a test read, the driver keeps
+* that to itself.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xparameters.h"
+#include "fsbl.h"
+
+#if defined(XPAR_PS7_SD_0_S_AXI_BASEADDR) || defined(XPAR_XSDPS_0_BASEADDR)
+
+#ifndef XPAR_PS7_SD_0_S_AXI_BASEADDR
+#define XPAR_PS7_SD_0_S_AXI_BASEADDR XPAR_XSDPS_0_BASEADDR
+#endif
+
+#include "sd_dma.h"
+
+#ifdef FSBL_SD_ADMA
+
+#include <string.h>
+#include "xil_io.h"
+#include "xil_cache.h"
+#include "ff.h"
+#include "diskio.h"
+#include "fsbl_poll.h"
+#include "fsbl_cache.h"
+#include "sd_hw.h"
+
+/************************** Constant Definitions *****************************/
+#define SD_DMA_SECTOR_SIZE		512
+
+/*
+ * ADMA2 descriptor attributes, a length of 0 is 64 KB
+ */
+#define SD_DESC_VALID			0x0001
+#define SD_DESC_END				0x0002
+#define SD_DESC_TRAN			0x0020
+#define SD_DESC_MAX_BYTES		0x10000
+
+#define SD_BLK_SIZE_KEEP_MASK	0x00007000
+
+#define SD_CMD17				SD_CMD(17, SD_RESP_R1 | SD_CMD_DATA)
+#define SD_CMD18				SD_CMD(18, SD_RESP_R1 | SD_CMD_DATA)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u16 Attribute;
+	u16 Length;
+	u32 Address;
+} SdDmaDesc;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 SdDmaTest(u32 Sector);
+
+/************************** Variable Definitions *****************************/
+static SdDmaDesc SdDescTable[SD_DMA_DESC_COUNT] __attribute__ ((aligned(32)));
+
+/*
+ * 1 when the card takes sector numbers, 0 for byte addresses
+ */
+static u32 SdBlockAddress;
+
+/*
+ * Set between SdDmaRead and SdDmaWait
+ */
+static u32 SdDmaBusy;
+
+/*
+ * Deadline of the running read, started by SdDmaRead
+ */
+static PollDeadline SdDmaDeadline;
+
+/*
+ * The sector read by the driver and by the test reads of SdDmaInit
+ */
+static u32 SdRefSector[SD_DMA_SECTOR_SIZE / 4] __attribute__ ((aligned(32)));
+static u32 SdTestSector[SD_DMA_SECTOR_SIZE / 4] __attribute__ ((aligned(32)));
+
+/******************************************************************************/
+/**
+*
+* This function finds out how the card is addressed. The sector is read by
+* the driver and then with ADMA2, first as a sector number and then as a
+* byte address, the first one that matches is used.
+*
+* @param	Sector is a sector of the boot image, not 0
+*
+* @return
+*		- XST_SUCCESS if the ADMA2 reads can be used
+*		- XST_FAILURE otherwise, the reads stay with the driver
+*
+* @note		None
+*
+****************************************************************************/
+u32 SdDmaInit(u32 Sector)
+{
+	u32 CacheState;
+	u32 Status = XST_FAILURE;
+
+	if (Sector == 0) {
+		return XST_FAILURE;
+	}
+
+	CacheState = CacheLoadSuspend();
+
+	if (disk_read(0, (BYTE *)SdRefSector, Sector, 1) == RES_OK) {
+		SdBlockAddress = 1;
+		Status = SdDmaTest(Sector);
+		if (Status != XST_SUCCESS) {
+			SdBlockAddress = 0;
+			Status = SdDmaTest(Sector);
+		}
+	}
+
+	CacheLoadResume(CacheState);
+
+	if (Status == XST_SUCCESS) {
+		fsbl_printf(DEBUG_INFO,"SD: ADMA2 reads, %s addressed\r\n",
+				SdBlockAddress ? "block" : "byte");
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+*
+* This function starts an ADMA2 read of consecutive sectors
+*
+* @param	Sector is the first sector on the card
+* @param	DestinationAddress is the word aligned destination
+* @param	Count is the number of sectors, at most SD_DMA_MAX_SECTORS
+*
+* @return
+*		- XST_SUCCESS if the read is started
+*		- XST_FAILURE if the arguments are not valid, the previous read
+*		  failed or the controller stays busy
+*
+* @note		A read still running is waited for first. The data must not
+*		be used before SdDmaWait returns.
+*
+****************************************************************************/
+u32 SdDmaRead(u32 Sector, u32 DestinationAddress, u32 Count)
+{
+	u32 Bytes;
+	u32 Length;
+	u32 Index = 0;
+	u32 Command;
+	u32 Mode;
+	u32 Status;
+
+	if ((Count == 0) || (Count > SD_DMA_MAX_SECTORS) ||
+			((DestinationAddress & 0x3) != 0)) {
+		return XST_FAILURE;
+	}
+
+	Status = SdDmaWait();
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * One descriptor per 64 KB of the destination
+	 */
+	Bytes = Count * SD_DMA_SECTOR_SIZE;
+	while (Bytes != 0) {
+		Length = (Bytes > SD_DESC_MAX_BYTES) ? SD_DESC_MAX_BYTES : Bytes;
+		SdDescTable[Index].Attribute = SD_DESC_VALID | SD_DESC_TRAN;
+		SdDescTable[Index].Length = (u16)Length;
+		SdDescTable[Index].Address = DestinationAddress;
+		DestinationAddress += Length;
+		Bytes -= Length;
+		Index++;
+	}
+	SdDescTable[Index - 1].Attribute |= SD_DESC_END;
+	Xil_DCacheFlushRange((u32)SdDescTable, Index * sizeof(SdDmaDesc));
+
+	Status = PollMask(POLL_SITE_SD_CMD, SD_HW_BASEADDR + SD_PRES_STATE_OFFSET,
+			SD_PSR_INHIBIT_CMD | SD_PSR_INHIBIT_DAT, 0);
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"SD: ADMA2, controller busy\r\n");
+		return XST_FAILURE;
+	}
+
+	Xil_Out8(SD_HW_BASEADDR + SD_HOST_CTRL_OFFSET,
+			(Xil_In8(SD_HW_BASEADDR + SD_HOST_CTRL_OFFSET) &
+				~SD_HC_DMA_MASK) | SD_HC_DMA_ADMA2);
+	Xil_Out32(SD_HW_BASEADDR + SD_ADMA_ADDR_OFFSET, (u32)SdDescTable);
+	Xil_Out32(SD_HW_BASEADDR + SD_BLK_SIZE_OFFSET, (Count << 16) |
+			(Xil_In32(SD_HW_BASEADDR + SD_BLK_SIZE_OFFSET) &
+				SD_BLK_SIZE_KEEP_MASK) | SD_DMA_SECTOR_SIZE);
+
+	Mode = SD_TM_DMA_EN | SD_TM_BLK_CNT_EN | SD_TM_READ;
+	if (Count > 1) {
+		Command = SD_CMD18;
+		Mode |= SD_TM_MULTI_BLK | SD_TM_AUTO_CMD12;
+	} else {
+		Command = SD_CMD17;
+	}
+
+	Xil_Out32(SD_HW_BASEADDR + SD_INTR_STS_OFFSET, SD_INTR_ALL);
+	Xil_Out32(SD_HW_BASEADDR + SD_ARG_OFFSET,
+			SdBlockAddress ? Sector : (Sector * SD_DMA_SECTOR_SIZE));
+	Xil_Out32(SD_HW_BASEADDR + SD_XFER_MODE_OFFSET, (Command << 16) | Mode);
+
+	PollStart(&SdDmaDeadline, POLL_SITE_SD_DMA);
+	SdDmaBusy = 1;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for the read started by SdDmaRead
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the data is in the destination, or no read
+*		  was running
+*		- XST_FAILURE on an error or a timeout, the CMD and DAT lines
+*		  are reset
+*
+* @note		The budget of the wait counts from the start of the read.
+*
+****************************************************************************/
+u32 SdDmaWait(void)
+{
+	u32 IntrStatus;
+
+	if (!SdDmaBusy) {
+		return XST_SUCCESS;
+	}
+	SdDmaBusy = 0;
+
+	do {
+		IntrStatus = Xil_In32(SD_HW_BASEADDR + SD_INTR_STS_OFFSET);
+	} while (((IntrStatus & (SD_INTR_TC | SD_INTR_ERR)) == 0) &&
+			!PollExpired(&SdDmaDeadline));
+	PollEnd(&SdDmaDeadline);
+
+	Xil_Out32(SD_HW_BASEADDR + SD_INTR_STS_OFFSET, SD_INTR_ALL);
+
+	if (((IntrStatus & SD_INTR_TC) != 0) &&
+			((IntrStatus & SD_INTR_ERR) == 0)) {
+		return XST_SUCCESS;
+	}
+
+	fsbl_printf(DEBUG_GENERAL,"SD: ADMA2 read failed, status %x\r\n",
+			IntrStatus);
+	Xil_Out8(SD_HW_BASEADDR + SD_SW_RST_OFFSET, SD_SWRST_CMD_DAT);
+	(void)PollMask(POLL_SITE_SD_CMD, SD_HW_BASEADDR + SD_CLK_CTRL_OFFSET,
+			SD_SWRST_CMD_DAT_MASK, 0);
+
+	return XST_FAILURE;
+}
+
+/******************************************************************************/
+/**
+*
+* This function checks the read started by SdDmaRead without waiting
+*
+* @param	None
+*
+* @return
+*		- XST_DEVICE_BUSY while the read is running
+*		- otherwise the result of SdDmaWait, which completes the read
+*
+* @note		None
+*
+****************************************************************************/
+u32 SdDmaPoll(void)
+{
+	u32 IntrStatus;
+
+	if (!SdDmaBusy) {
+		return XST_SUCCESS;
+	}
+
+	IntrStatus = Xil_In32(SD_HW_BASEADDR + SD_INTR_STS_OFFSET);
+	if (((IntrStatus & (SD_INTR_TC | SD_INTR_ERR)) == 0) &&
+			!PollExpired(&SdDmaDeadline)) {
+		return XST_DEVICE_BUSY;
+	}
+
+	return SdDmaWait();
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads a sector with ADMA2 and compares it with the copy
+* read by the driver
+*
+* @param	Sector is the sector
+*
+* @return
+*		- XST_SUCCESS if both match
+*		- XST_FAILURE otherwise
+*
+* @note		None
+*
+****************************************************************************/
+static u32 SdDmaTest(u32 Sector)
+{
+	u32 Status;
+
+	memset(SdTestSector, 0, sizeof(SdTestSector));
+
+	Status = SdDmaRead(Sector, (u32)SdTestSector, 1);
+	if (Status == XST_SUCCESS) {
+		Status = SdDmaWait();
+	}
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (memcmp(SdTestSector, SdRefSector, SD_DMA_SECTOR_SIZE) != 0) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+#endif /* FSBL_SD_ADMA */
+
+#endif
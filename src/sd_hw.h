@@ -0,0 +1,135 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file sd_hw.h
+*
+* Contains the SD host controller registers used by sd_bus.c and sd_dma.c.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00a hx	10/18/26	Initial release
+*
+* </pre>
+*
+* @note
+*
+* Only the registers and bits the FSBL programs itself are listed, the rest
+* is left to the xsdps driver.
+*
+******************************************************************************/
+#ifndef ___SD_HW_H___
+#define ___SD_HW_H___
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xparameters.h"
+
+/************************** Constant Definitions *****************************/
+#define SD_HW_BASEADDR			XPAR_PS7_SD_0_S_AXI_BASEADDR
+
+/*
+ * Host controller registers
+ */
+#define SD_BLK_SIZE_OFFSET		0x04
+#define SD_ARG_OFFSET			0x08
+#define SD_XFER_MODE_OFFSET		0x0C
+#define SD_RESP0_OFFSET			0x10
+#define SD_BUF_DATA_OFFSET		0x20
+#define SD_PRES_STATE_OFFSET	0x24
+#define SD_HOST_CTRL_OFFSET		0x28
+#define SD_CLK_CTRL_OFFSET		0x2C
+#define SD_SW_RST_OFFSET		0x2F
+#define SD_INTR_STS_OFFSET		0x30
+#define SD_ADMA_ADDR_OFFSET		0x58
+
+#define SD_PSR_INHIBIT_CMD		0x00000001
+#define SD_PSR_INHIBIT_DAT		0x00000002
+
+#define SD_HC_4BIT				0x02
+#define SD_HC_HIGH_SPEED		0x04
+#define SD_HC_DMA_MASK			0x18
+#define SD_HC_DMA_ADMA2			0x10
+
+#define SD_CC_INT_CLK_EN		0x0001
+#define SD_CC_INT_CLK_STABLE	0x0002
+#define SD_CC_SD_CLK_EN			0x0004
+#define SD_CC_DIV_SHIFT			8
+#define SD_CC_DIV_MAX			256
+
+#define SD_SWRST_CMD_DAT		0x06
+#define SD_SWRST_CMD_DAT_MASK	(SD_SWRST_CMD_DAT << 24)
+
+#define SD_INTR_CC				0x00000001
+#define SD_INTR_TC				0x00000002
+#define SD_INTR_BRR				0x00000020
+#define SD_INTR_ERR				0x00008000
+#define SD_INTR_ALL				0xFFFFFFFF
+
+#define SD_TM_DMA_EN			0x0001
+#define SD_TM_BLK_CNT_EN		0x0002
+#define SD_TM_AUTO_CMD12		0x0004
+#define SD_TM_READ				0x0010
+#define SD_TM_MULTI_BLK			0x0020
+
+/*
+ * Command register, response type and checks
+ */
+#define SD_RESP_NONE			0x00
+#define SD_RESP_R2				0x09
+#define SD_RESP_R3				0x02
+#define SD_RESP_R1				0x1A
+#define SD_RESP_R1B				0x1B
+#define SD_RESP_BUSY_MASK		0x03
+#define SD_CMD_DATA				0x20
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define SD_CMD(Index, Flags)	(((Index) << 8) | (Flags))
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ___SD_HW_H___ */
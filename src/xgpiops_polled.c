@@ -63,6 +63,7 @@
 * 1.01a sv   04/15/12 Removed the calling of some unnecessary APIs.
 *		      Updated the examples for a ZC702 board .
 *		      Updated the example to use only pin APIs.
+* 12.00a hx  10/18/26 Added GpioReadStrap for the boot delay strap
 *
 * </pre>
 *
@@ -174,3 +175,23 @@ int GpioOutputLedOff(void)
 	return XST_SUCCESS;
 }
 
+
+/*****************************************************************************/
+/**
+*
+* This function configures a pin as input and returns its level.
+*
+* @param	Pin is the GPIO pin number
+*
+* @return	The pin level, 0 or 1
+*
+* @note		GpioPolledExampleInit must have been called
+*
+******************************************************************************/
+u32 GpioReadStrap(u32 Pin)
+{
+	XGpioPs_SetDirectionPin(&Gpio, Pin, 0);
+
+	return (u32)XGpioPs_ReadPin(&Gpio, Pin);
+}
+
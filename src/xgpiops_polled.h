@@ -63,6 +63,7 @@
 * 1.01a sv   04/15/12 Removed the calling of some unnecessary APIs.
 *		      Updated the examples for a ZC702 board .
 *		      Updated the example to use only pin APIs.
+* 12.00a hx  10/18/26 Added GpioReadStrap for the boot delay strap
 *
 * </pre>
 *
@@ -95,6 +96,7 @@
 int GpioPolledExampleInit( void );
 int GpioOutputLedOn(void);
 int GpioOutputLedOff(void);
+u32 GpioReadStrap(u32 Pin);
 
 #ifdef __cplusplus
 }
@@ -104,6 +104,7 @@
 
 #include "xqspips.h"
 #include "sleep.h"
+#include "fsbl_pmu.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -730,6 +731,8 @@ int XQspiPs_PolledTransfer(XQspiPs *InstancePtr, u8 *SendBufPtr,
 		return XST_DEVICE_BUSY;
 	}
 
+	PMU_SCOPE_BEGIN(PMU_SCOPE_QSPI_POLLED_XFER);
+
 	/*
 	 * Set the busy flag, which will be cleared when the transfer is
 	 * entirely done.
@@ -1038,6 +1041,8 @@ int XQspiPs_PolledTransfer(XQspiPs *InstancePtr, u8 *SendBufPtr,
 	XQspiPs_WriteReg(InstancePtr->Config.BaseAddress,
 			XQSPIPS_RXWR_OFFSET, XQSPIPS_RXWR_RESET_VALUE);
 
+	PMU_SCOPE_END(PMU_SCOPE_QSPI_POLLED_XFER);
+
 	return XST_SUCCESS;
 }
 
@@ -0,0 +1,536 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# Use of the Software is limited solely to applications:
+# (a) running on a Xilinx device, or
+# (b) that interact with a Xilinx device through a bus or interconnect.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+# WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+# OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# Except as contained in this notice, the name of the Xilinx shall not be used
+# in advertising or otherwise to promote the sale, use or other dealings in
+# this Software without prior written authorization from Xilinx.
+#
+"""Check the PL330 microcode that fsbl_dma.c builds for FSBL_DMA_COPY.
+
+DmaBuild() and the DmaEmit*() helpers are taken out of src/fsbl_dma.c as
+they are, together with the DMA_* constants and DmaCcr(), and compiled on
+the host into a small program that prints the microcode for a source,
+destination and length. The copies of random alignments and lengths, and
+lengths around the loop and DMA_MAX_BURSTS boundaries, are then split
+into programs the way DmaCopyAsync() does and each program is:
+
+  - compared byte for byte with programs assembled here from the PL330
+    encodings, for a few fixed copies (see KNOWN)
+  - decoded, failing on an unknown instruction, a bad DMAMOV register,
+    a CCR with other than incrementing bufferable bursts of equal source
+    and destination beats, or a program longer than DMA_PROGRAM_SIZE
+  - run on a model of the channel thread: every DMALPEND must jump back
+    to the first instruction after its DMALP, loops must nest, DMAEND must
+    be the last byte after a DMAWMB, and the loads and stores must move
+    the source to the destination in order, with aligned beats, without a
+    gap and without going past the bytes the program reports as moved
+  - checked to use the widest beat both addresses allow for its bursts,
+    leaving only the head and tail to narrower beats
+
+Usage:
+  pl330_check.py [--cases N] [--seed N] [src/fsbl_dma.c]
+
+CC selects the host compiler, cc by default.
+"""
+
+import argparse
+import os
+import random
+import re
+import subprocess
+import sys
+import tempfile
+
+# Instructions, from the PL330 TRM
+INSN_END = 0x00
+INSN_LD = 0x04
+INSN_ST = 0x08
+INSN_WMB = 0x13
+INSN_LP = 0x20
+INSN_LPEND = 0x38
+INSN_MOV = 0xBC
+
+LP_LC1 = 0x02
+LPEND_LC1 = 0x04
+
+REG_SAR = 0
+REG_CCR = 1
+REG_DAR = 2
+REG_NAMES = {"SAR": REG_SAR, "CCR": REG_CCR, "DAR": REG_DAR}
+
+# CCR fields
+CCR_SRC_INC = 1 << 0
+CCR_SRC_SIZE = 1
+CCR_SRC_LEN = 4
+CCR_SRC_CACHE = 11
+CCR_DST_INC = 1 << 14
+CCR_DST_SIZE = 15
+CCR_DST_LEN = 18
+CCR_DST_CACHE = 25
+CCR_BUFFERABLE = 0x1
+
+# Functions taken from fsbl_dma.c
+FUNCTIONS = ("DmaEmit", "DmaEmitMov", "DmaEmitCopy", "DmaBuild")
+
+HARNESS = r"""
+#include <stdio.h>
+
+typedef unsigned char u8;
+typedef unsigned int u32;
+
+%(defines)s
+
+%(typedef)s
+
+%(macros)s
+
+%(prototypes)s
+
+%(functions)s
+
+int main(void)
+{
+	static u8 Buf[DMA_PROGRAM_SIZE * 4];
+	unsigned int Source, Destination, Length;
+	DmaProgram Prog;
+	u32 Done;
+	u32 Index;
+
+	while (scanf("%%x %%x %%x", &Source, &Destination, &Length) == 3) {
+		Prog.Buf = Buf;
+		Prog.Len = 0;
+		Done = DmaBuild(&Prog, Source, Destination, Length);
+		printf("%%x %%x", Done, Prog.Len);
+		for (Index = 0; (Index < Prog.Len) && (Index < sizeof(Buf));
+				Index++) {
+			printf(" %%02x", Buf[Index]);
+		}
+		printf("\n");
+	}
+	return 0;
+}
+"""
+
+
+class CheckError(Exception):
+    pass
+
+
+def parse_source(path):
+    """Cut the encoder out of fsbl_dma.c, return its C and the constants"""
+    with open(path) as f:
+        text = f.read()
+
+    defines = []
+    consts = {}
+    for m in re.finditer(r"^#define (DMA_\w+)(\(\w+\))?[ \t]+(.+)$",
+                         text, re.M):
+        name, args, value = m.groups()
+        if "XPS_" in value:
+            continue
+        defines.append(m.group(0))
+        if not args:
+            consts[name] = value.strip()
+
+    m = re.search(r"typedef struct \{[^}]*\bBuf;[^}]*\} DmaProgram;", text)
+    if not m:
+        raise CheckError("%s: DmaProgram not found" % path)
+    typedef = m.group(0)
+
+    m = re.search(r"^#define DmaCcr\(.*?[^\\]\n", text, re.M | re.S)
+    if not m:
+        raise CheckError("%s: DmaCcr not found" % path)
+    macros = m.group(0)
+
+    prototypes = []
+    functions = []
+    for name in FUNCTIONS:
+        m = re.search(r"^static \w+ %s\([^;{]*\)\n\{.*?^\}\n" % name,
+                      text, re.M | re.S)
+        if not m:
+            raise CheckError("%s: %s not found" % (path, name))
+        functions.append(m.group(0))
+        prototypes.append(m.group(0).split("\n{")[0] + ";")
+
+    source = HARNESS % {
+        "defines": "\n".join(defines),
+        "typedef": typedef,
+        "macros": macros,
+        "prototypes": "\n".join(prototypes),
+        "functions": "\n".join(functions),
+    }
+    return source, consts
+
+
+def const(consts, name):
+    """Evaluate a DMA_* constant, which may refer to other ones"""
+    value = consts[name]
+    value = re.sub(r"\b(DMA_\w+)\b",
+                   lambda m: "(%d)" % const(consts, m.group(1)), value)
+    return int(eval(value, {"__builtins__": {}}))
+
+
+class Builder:
+    """The compiled DmaBuild(), fed in batches"""
+
+    def __init__(self, source, workdir):
+        cc = os.environ.get("CC", "cc")
+        path = os.path.join(workdir, "pl330_build.c")
+        self.exe = os.path.join(workdir, "pl330_build")
+        with open(path, "w") as f:
+            f.write(source)
+        result = subprocess.run([cc, "-O1", "-Wall", "-o", self.exe, path],
+                                capture_output=True, text=True)
+        if result.returncode != 0:
+            raise CheckError("host build failed:\n" + result.stderr)
+
+    def build(self, requests):
+        text = "".join("%x %x %x\n" % r for r in requests)
+        result = subprocess.run([self.exe], input=text, capture_output=True,
+                                text=True, check=True)
+        out = []
+        for line in result.stdout.splitlines():
+            words = line.split()
+            done, length = int(words[0], 16), int(words[1], 16)
+            code = bytes(int(w, 16) for w in words[2:])
+            if length != len(code):
+                raise CheckError("program of %d bytes overran the harness"
+                                 % length)
+            out.append((done, code))
+        return out
+
+
+def ccr(shift, beats):
+    return (CCR_SRC_INC | (shift << CCR_SRC_SIZE) |
+            ((beats - 1) << CCR_SRC_LEN) | (CCR_BUFFERABLE << CCR_SRC_CACHE) |
+            CCR_DST_INC | (shift << CCR_DST_SIZE) |
+            ((beats - 1) << CCR_DST_LEN) | (CCR_BUFFERABLE << CCR_DST_CACHE))
+
+
+def assemble(insns):
+    """Assemble ("MOV", reg, value), ("LP", lc, count), ("LPEND", lc),
+    ("LD",), ("ST",), ("WMB",) and ("END",) from the TRM encodings"""
+    code = bytearray()
+    starts = {}
+    for insn in insns:
+        op = insn[0]
+        if op == "MOV":
+            code += bytes([INSN_MOV, REG_NAMES[insn[1]]])
+            code += insn[2].to_bytes(4, "little")
+        elif op == "LP":
+            code += bytes([INSN_LP | (LP_LC1 if insn[1] else 0),
+                           insn[2] - 1])
+            starts[insn[1]] = len(code)
+        elif op == "LPEND":
+            jump = len(code) - starts.pop(insn[1])
+            code += bytes([INSN_LPEND | (LPEND_LC1 if insn[1] else 0), jump])
+        elif op == "LD":
+            code.append(INSN_LD)
+        elif op == "ST":
+            code.append(INSN_ST)
+        elif op == "WMB":
+            code.append(INSN_WMB)
+        elif op == "END":
+            code.append(INSN_END)
+    return bytes(code)
+
+
+# Copies with the program they must build: (source, destination, length),
+# bytes moved, instructions
+KNOWN = [
+    # Two bursts of 16 doublewords
+    ((0x00100000, 0x00200000, 256), 256, [
+        ("MOV", "SAR", 0x00100000), ("MOV", "DAR", 0x00200000),
+        ("MOV", "CCR", ccr(3, 16)),
+        ("LP", 0, 2), ("LD",), ("ST",), ("LPEND", 0),
+        ("WMB",), ("END",)]),
+    # Halfword aligned together: a head byte, then one halfword beat
+    ((0x00100001, 0x00200003, 3), 3, [
+        ("MOV", "SAR", 0x00100001), ("MOV", "DAR", 0x00200003),
+        ("MOV", "CCR", ccr(0, 1)), ("LD",), ("ST",),
+        ("MOV", "CCR", ccr(1, 1)), ("LD",), ("ST",),
+        ("WMB",), ("END",)]),
+    # 512 bursts in the nested loops, one doubleword tail
+    ((0x00100000, 0x00200000, 512 * 128 + 8), 512 * 128 + 8, [
+        ("MOV", "SAR", 0x00100000), ("MOV", "DAR", 0x00200000),
+        ("MOV", "CCR", ccr(3, 16)),
+        ("LP", 1, 2), ("LP", 0, 256), ("LD",), ("ST",), ("LPEND", 0),
+        ("LPEND", 1),
+        ("MOV", "CCR", ccr(3, 1)), ("LD",), ("ST",),
+        ("WMB",), ("END",)]),
+    # Byte aligned: 3 bursts of 16 bytes and 5 single bytes
+    ((0x00100000, 0x00200001, 53), 53, [
+        ("MOV", "SAR", 0x00100000), ("MOV", "DAR", 0x00200001),
+        ("MOV", "CCR", ccr(0, 16)),
+        ("LP", 0, 3), ("LD",), ("ST",), ("LPEND", 0),
+        ("MOV", "CCR", ccr(0, 1)),
+        ("LP", 0, 5), ("LD",), ("ST",), ("LPEND", 0),
+        ("WMB",), ("END",)]),
+]
+
+
+def beat_shift(source, destination):
+    shift = 3
+    while shift > 0 and (source ^ destination) & ((1 << shift) - 1):
+        shift -= 1
+    return shift
+
+
+def decode_ccr(value):
+    """Beat shift and beats of a CCR value, fail on anything else set"""
+    shift = (value >> CCR_SRC_SIZE) & 0x7
+    beats = ((value >> CCR_SRC_LEN) & 0xF) + 1
+    if shift > 3 or value != ccr(shift, beats):
+        raise CheckError("CCR 0x%08X is not an incrementing bufferable copy"
+                         " of equal beats" % value)
+    return shift, beats
+
+
+def run(code, source, destination, length, done, limit):
+    """Run one program on the channel model, return the bytes moved per
+    (beat shift, beats)"""
+    if len(code) > limit:
+        raise CheckError("program of %d bytes, limit %d" % (len(code), limit))
+    if done == 0 or done > length:
+        raise CheckError("moves %d of %d bytes" % (done, length))
+
+    regs = {}
+    loops = []
+    pending = None
+    cursor = source
+    moved = {}
+    pc = 0
+    while True:
+        if pc >= len(code):
+            raise CheckError("runs past the end at %d" % pc)
+        op = code[pc]
+        if op == INSN_MOV:
+            if pc + 6 > len(code):
+                raise CheckError("DMAMOV cut short at %d" % pc)
+            reg = code[pc + 1]
+            value = int.from_bytes(code[pc + 2:pc + 6], "little")
+            if reg not in REG_NAMES.values():
+                raise CheckError("DMAMOV to register %d at %d" % (reg, pc))
+            regs[reg] = decode_ccr(value) if reg == REG_CCR else value
+            pc += 6
+        elif op in (INSN_LP, INSN_LP | LP_LC1):
+            lc = 1 if op & LP_LC1 else 0
+            if any(loop[0] == lc for loop in loops):
+                raise CheckError("DMALP %d at %d inside loop %d"
+                                 % (lc, pc, lc))
+            loops.append([lc, code[pc + 1], pc + 2])
+            pc += 2
+        elif op in (INSN_LPEND, INSN_LPEND | LPEND_LC1):
+            lc = 1 if op & LPEND_LC1 else 0
+            if not loops or loops[-1][0] != lc:
+                raise CheckError("DMALPEND %d at %d outside its loop"
+                                 % (lc, pc))
+            loop = loops[-1]
+            target = pc - code[pc + 1]
+            if target != loop[2]:
+                raise CheckError("DMALPEND at %d jumps to %d, loop starts"
+                                 " at %d" % (pc, target, loop[2]))
+            if loop[1] == 0:
+                loops.pop()
+                pc += 2
+            elif code[target:pc] == bytes([INSN_LD, INSN_ST]):
+                # The rest of a plain burst loop at once
+                shift, beats = regs[REG_CCR]
+                step = loop[1] * (beats << shift)
+                regs[REG_SAR] += step
+                regs[REG_DAR] += step
+                cursor += step
+                key = (shift, beats)
+                moved[key] = moved.get(key, 0) + step
+                loops.pop()
+                pc += 2
+            else:
+                loop[1] -= 1
+                pc = target
+        elif op == INSN_LD:
+            if pending is not None:
+                raise CheckError("DMALD at %d after DMALD" % pc)
+            if REG_CCR not in regs or REG_SAR not in regs:
+                raise CheckError("DMALD at %d before CCR and SAR" % pc)
+            shift, beats = regs[REG_CCR]
+            if regs[REG_SAR] != cursor:
+                raise CheckError("DMALD at %d from 0x%08X, expected 0x%08X"
+                                 % (pc, regs[REG_SAR], cursor))
+            if regs[REG_SAR] & ((1 << shift) - 1):
+                raise CheckError("DMALD at %d of unaligned %d byte beats"
+                                 % (pc, 1 << shift))
+            pending = (regs[REG_SAR], beats << shift)
+            regs[REG_SAR] += beats << shift
+            pc += 1
+        elif op == INSN_ST:
+            if pending is None:
+                raise CheckError("DMAST at %d without DMALD" % pc)
+            if REG_DAR not in regs:
+                raise CheckError("DMAST at %d before DAR" % pc)
+            shift, beats = regs[REG_CCR]
+            address, size = pending
+            if size != beats << shift:
+                raise CheckError("DMAST at %d with another CCR" % pc)
+            if regs[REG_DAR] != destination + (address - source):
+                raise CheckError("DMAST at %d to 0x%08X for 0x%08X"
+                                 % (pc, regs[REG_DAR], address))
+            if regs[REG_DAR] & ((1 << shift) - 1):
+                raise CheckError("DMAST at %d of unaligned %d byte beats"
+                                 % (pc, 1 << shift))
+            regs[REG_DAR] += size
+            cursor = address + size
+            key = (shift, beats)
+            moved[key] = moved.get(key, 0) + size
+            pending = None
+            pc += 1
+        elif op == INSN_WMB:
+            pc += 1
+        elif op == INSN_END:
+            if pc != len(code) - 1:
+                raise CheckError("DMAEND at %d of %d" % (pc, len(code)))
+            if pc == 0 or code[pc - 1] != INSN_WMB:
+                raise CheckError("DMAEND without DMAWMB")
+            if loops or pending is not None:
+                raise CheckError("DMAEND inside a loop or after DMALD")
+            break
+        else:
+            raise CheckError("instruction 0x%02X at %d" % (op, pc))
+
+    if cursor - source != done:
+        raise CheckError("moved %d bytes, reported %d"
+                         % (cursor - source, done))
+    return moved
+
+
+def check_widths(moved, source, destination, burst_beats):
+    """Bursts use the widest beat, narrower beats only the head and tail"""
+    shift = beat_shift(source, destination)
+    size = 1 << shift
+    for (s, beats), count in moved.items():
+        if beats == burst_beats and s != shift:
+            raise CheckError("bursts of %d byte beats, %d possible"
+                             % (1 << s, size))
+        if beats != burst_beats and s == shift and count >= burst_beats * size:
+            raise CheckError("%d bytes in single beats" % count)
+        if s < shift and count > 2 * (size - 1):
+            raise CheckError("%d bytes in %d byte beats" % (count, 1 << s))
+
+
+def make_cases(rng, count, consts):
+    burst = const(consts, "DMA_BURST_BEATS")
+    loop = const(consts, "DMA_LOOP_MAX")
+    most = const(consts, "DMA_MAX_BURSTS")
+    edges = (1, loop - 1, loop, loop + 1, loop * loop - 1, loop * loop,
+             loop * loop + 1, most - 1, most, most + 1, 2 * most + 3)
+    cases = []
+    for n in range(count):
+        source = 0x00100000 + rng.randrange(0x1000)
+        destination = 0x04000000 + (source & 0xFF8) + rng.randrange(0x1000)
+        if rng.randrange(2):
+            destination ^= (destination ^ source) & rng.choice((7, 3, 1))
+        size = 1 << beat_shift(source, destination)
+        kind = n % 4
+        if kind == 0:
+            length = rng.randrange(1, 64)
+        elif kind == 1:
+            length = rng.randrange(1, 8192)
+        elif kind == 2:
+            length = int(2 ** rng.uniform(13, 24))
+        else:
+            head = (size - (source & (size - 1))) & (size - 1)
+            length = (head + rng.choice(edges) * size * burst +
+                      rng.randrange(-size, size + 1))
+        cases.append((source, destination, max(length, 1)))
+    return cases
+
+
+def check(path, count, seed):
+    source_text, consts = parse_source(path)
+    limit = const(consts, "DMA_PROGRAM_SIZE")
+    burst = const(consts, "DMA_BURST_BEATS")
+    errors = []
+    with tempfile.TemporaryDirectory() as workdir:
+        builder = Builder(source_text, workdir)
+
+        results = builder.build([copy for copy, _, _ in KNOWN])
+        for (copy, done, insns), (got_done, code) in zip(KNOWN, results):
+            want = assemble(insns)
+            if (got_done, code) != (done, want):
+                errors.append("0x%08X -> 0x%08X, %d bytes: built %d bytes"
+                              " %s, expected %d bytes %s"
+                              % (copy + (got_done, code.hex(), done,
+                                         want.hex())))
+
+        cases = make_cases(random.Random(seed), count, consts)
+        left = [[c, c[0], c[1], c[2]] for c in cases]
+        programs = 0
+        longest = 0
+        while left:
+            results = builder.build([tuple(c[1:]) for c in left])
+            busy = []
+            for c, (done, code) in zip(left, results):
+                case, source, destination, length = c
+                programs += 1
+                longest = max(longest, len(code))
+                try:
+                    moved = run(code, source, destination, length, done,
+                                limit)
+                    check_widths(moved, source, destination, burst)
+                except CheckError as e:
+                    errors.append("0x%08X -> 0x%08X, %d bytes at 0x%08X: %s"
+                                  % (case + (source, e)))
+                    continue
+                if done < length:
+                    busy.append([case, source + done, destination + done,
+                                 length - done])
+            left = busy
+
+    print("%d copies, %d programs, longest %d bytes of %d"
+          % (len(cases), programs, longest, limit))
+    for e in errors:
+        print("error: " + e, file=sys.stderr)
+    return 1 if errors else 0
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--cases", type=int, default=2000,
+                        help="random copies to check")
+    parser.add_argument("--seed", type=int, default=0)
+    parser.add_argument("source", nargs="?",
+                        default=os.path.join(here, "..", "src", "fsbl_dma.c"))
+    args = parser.parse_args()
+
+    try:
+        return check(args.source, args.cases, args.seed)
+    except CheckError as e:
+        print("error: " + str(e), file=sys.stderr)
+        return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,959 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2012 - 2014 Xilinx, Inc.  All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# Use of the Software is limited solely to applications:
+# (a) running on a Xilinx device, or
+# (b) that interact with a Xilinx device through a bus or interconnect.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+# WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+# OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# Except as contained in this notice, the name of the Xilinx shall not be used
+# in advertising or otherwise to promote the sale, use or other dealings in
+# this Software without prior written authorization from Xilinx.
+#
+"""Compile the ps7_init.c EMIT_* tables into precompiled register sequences.
+
+The PCW generated ps7_init.c describes the PS setup as tables of opcodes,
+ps7_config() decodes them word by word at boot. This script turns every
+table into a ps7_seq_t (see src/ps7_init_gen.h): runs of the same operation
+over struct-of-arrays address/mask/value data, so ps7_run() only has to
+dispatch once per run.
+
+While compiling:
+  - mask writes with a full mask become plain writes (no read back)
+  - consecutive mask writes to the same register are merged into one when
+    the masks are disjoint and the register is not one where the order of
+    the field updates matters (see NO_MERGE)
+  - the PLL tables are reordered so the ARM, DDR and IO PLLs are set up
+    and released from reset back to back and then share a single lock
+    wait (MASKPOLL_ALL on PLL_STATUS) before leaving bypass, see
+    parallel_plls(). --no-parallel-pll keeps the original order.
+
+The sequences are stored compactly: addresses as 16 bit deltas, masks as
+byte indexes into one shared ps7_masks[] pool, and each kind of table only
+once. The first silicon version of a table is its base stream, the other
+versions and the variants below are emitted as ps7_delta_t patches
+against it (see make_deltas()), which ps7_run() applies while running.
+
+For the warm reset fast path (PS7_WARM_RESET_FAST) it also emits, per
+silicon version, a fingerprint of the PLL, DDRIOB and DDRC configuration
+(the bits the tables leave set, see fingerprint()) and a MIO sequence
+without the DDRIOB writes, which must not be redone while DDR is live.
+The fingerprint value also identifies the DDR configuration a cached DDR
+training record (PS7_DDR_TRAIN_CACHE) was taken with. For that cache the
+DDR table is also emitted split in two at the release of the DDRC reset
+(_cfg and _start), so the trained PHY ratios can be programmed in between.
+
+Usage:
+  ps7_compile.py [--no-parallel-pll] [-o src/ps7_init_gen.c] [src/ps7_init.c]
+  ps7_compile.py --check [src/ps7_init.c] [src/ps7_init_gen.c]
+
+--check parses the emitted C back, expands the deltas, runs both the original tables and the
+compiled sequences against a register model and fails if the register
+write sequence differs, other than by the merges above, or if the register
+state differs at any poll, delay or at the end of a sequence. For the
+reordered PLL tables the write order is compared per register instead and
+a PLL model checks the bring-up rules, see PllModel.
+"""
+
+import argparse
+import difflib
+import os
+import re
+import sys
+
+FULL_MASK = 0xFFFFFFFF
+
+# Address encoding, must match ps7_init_gen.h
+ADDR_ORIGIN = 0xF8000000
+ADDR_FAR = 0x8000
+
+# Run operations, must match ps7_init_gen.h
+OP_WRITE = 0
+OP_MASKWRITE = 1
+OP_MASKPOLL = 2
+OP_MASKDELAY = 3
+OP_MASKPOLL_ALL = 4
+
+OP_NAMES = {
+    OP_WRITE: "PS7_RUN_WRITE",
+    OP_MASKWRITE: "PS7_RUN_MASKWRITE",
+    OP_MASKPOLL: "PS7_RUN_MASKPOLL",
+    OP_MASKDELAY: "PS7_RUN_MASKDELAY",
+    OP_MASKPOLL_ALL: "PS7_RUN_MASKPOLL_ALL",
+}
+
+# Which arrays an operation consumes: (addr, mask, val)
+OP_FIELDS = {
+    OP_WRITE: (True, False, True),
+    OP_MASKWRITE: (True, True, True),
+    OP_MASKPOLL: (True, True, False),
+    OP_MASKDELAY: (True, True, False),
+    OP_MASKPOLL_ALL: (True, True, False),
+}
+
+# Registers whose field updates must stay separate writes
+NO_MERGE = {
+    0xF8000004,  # SLCR_LOCK
+    0xF8000008,  # SLCR_UNLOCK
+    0xF8000100,  # ARM_PLL_CTRL
+    0xF8000104,  # DDR_PLL_CTRL
+    0xF8000108,  # IO_PLL_CTRL
+    0xF8000200,  # PSS_RST_CTRL
+    0xF8000B70,  # DDRIOB_DCI_CTRL
+    0xF8006000,  # DDRC_CTRL
+}
+
+PLL_STATUS = 0xF800010C
+
+# PLL_CTRL register of each PLL, its PLL_CFG is 0x10 above
+PLL_CTRL = (0xF8000100, 0xF8000104, 0xF8000108)
+
+PLL_RESET = 0x00000001
+PLL_BYPASS_FORCE = 0x00000010
+PLL_FDIV = 0x0007F000
+
+# DDRIOB registers, set up by the MIO table
+DDRIOB_FIRST = 0xF8000B40
+DDRIOB_LAST = 0xF8000B7C
+
+# Registers that do not read back what was written
+NO_FINGERPRINT = {
+    0xF8000004,  # SLCR_LOCK
+    0xF8000008,  # SLCR_UNLOCK
+    0xF8000B70,  # DDRIOB_DCI_CTRL, reset toggled during init
+}
+
+DDRC_CTRL = 0xF8006000
+
+# PHY registers programmed from a cached training record, they must not be
+# written by the _start half of the DDR table
+DDR_TRAIN_REGS = set(range(0xF8006140, 0xF800618C, 4)) | {0xF8006194}
+
+TABLE_RE = re.compile(r"unsigned long (\w+)\[\] = \{(.*?)\};", re.S)
+EMIT_RE = re.compile(r"EMIT_(\w+)\(([^)]*)\)")
+
+
+def parse_int(text):
+    return int(text.strip().rstrip("uUlL"), 0)
+
+
+def parse_tables(path):
+    """Return [(name, [(op, args)])] for every EMIT table in ps7_init.c"""
+    with open(path) as f:
+        text = re.sub(r"//.*", "", f.read())
+    tables = []
+    for m in TABLE_RE.finditer(text):
+        ops = []
+        for op, args in EMIT_RE.findall(m.group(2)):
+            args = [parse_int(a) for a in args.split(",") if a.strip()]
+            ops.append((op, args))
+            if op == "EXIT":
+                break
+        tables.append((m.group(1), ops))
+    return tables
+
+
+def parallel_plls(ops):
+    """Reorder a PLL table so all the PLLs lock in parallel.
+
+    The PCW sequence per PLL is: PLL_CFG, FB_DIV, bypass, assert reset,
+    deassert reset, poll lock, remove bypass, followed by the clock
+    control of the domain. The result keeps every PLL's own order but
+    does the setup of all PLLs first, then the three reset deasserts,
+    then one poll for all the lock bits and then the bypass removals.
+    Returns None if the table does not have that shape.
+    """
+    polls = [i for i, (op, args) in enumerate(ops)
+             if op == "MASKPOLL" and args[0] == PLL_STATUS]
+    if len(polls) < 2:
+        return None
+    blocks = []
+    for p in polls:
+        op, args = ops[p - 1]
+        if (op != "MASKWRITE" or args[0] not in PLL_CTRL or
+                args[1] != PLL_RESET or args[2] != 0):
+            return None
+        ctrl = args[0]
+        start = p - 1
+        while start > 0 and ops[start - 1][0] == "MASKWRITE" and \
+                ops[start - 1][1][0] in (ctrl, ctrl + 0x10):
+            start -= 1
+        blocks.append([start, p])
+    for k in range(len(blocks) - 1):
+        if blocks[k][1] >= blocks[k + 1][0]:
+            return None
+    # remove bypass and clock controls, up to the next PLL or the end of
+    # the PLL/clock control registers
+    tail = polls[-1] + 1
+    while tail < len(ops) and ops[tail][0] == "MASKWRITE" and \
+            0xF8000100 <= ops[tail][1][0] <= 0xF800012C:
+        tail += 1
+    ends = [blocks[k + 1][0] for k in range(len(blocks) - 1)] + [tail]
+
+    out = list(ops[:blocks[0][0]])
+    for start, p in blocks:
+        out += ops[start:p - 1]
+    mask = 0
+    for start, p in blocks:
+        out.append(ops[p - 1])
+        mask |= ops[p][1][1]
+    out.append(("MASKPOLL_ALL", [PLL_STATUS, mask]))
+    for (start, p), end in zip(blocks, ends):
+        out += ops[p + 1:end]
+    out += ops[tail:]
+    return out
+
+
+def compile_table(ops):
+    """Return the list of (op, addr, mask, val) of the compiled sequence"""
+    out = []
+    for op, args in ops:
+        if op == "EXIT":
+            break
+        if op == "CLEAR":
+            out.append([OP_WRITE, args[0], FULL_MASK, 0])
+        elif op == "WRITE":
+            out.append([OP_WRITE, args[0], FULL_MASK, args[1]])
+        elif op == "MASKWRITE":
+            addr, mask, val = args
+            prev = out[-1] if out else None
+            if (prev is not None and prev[0] == OP_MASKWRITE and
+                    prev[1] == addr and addr not in NO_MERGE and
+                    (prev[2] & mask) == 0):
+                prev[2] |= mask
+                prev[3] = (prev[3] & ~mask) | (val & mask)
+            else:
+                out.append([OP_MASKWRITE, addr, mask, val & mask])
+        elif op == "MASKPOLL":
+            out.append([OP_MASKPOLL, args[0], args[1], 0])
+        elif op == "MASKPOLL_ALL":
+            out.append([OP_MASKPOLL_ALL, args[0], args[1], 0])
+        elif op == "MASKDELAY":
+            out.append([OP_MASKDELAY, args[0], args[1], 0])
+        else:
+            raise ValueError("unknown opcode EMIT_%s" % op)
+    for entry in out:
+        if entry[0] == OP_MASKWRITE and entry[2] == FULL_MASK:
+            entry[0] = OP_WRITE
+    return out
+
+
+def make_runs(seq):
+    runs = []
+    for entry in seq:
+        if runs and runs[-1][0] == entry[0] and runs[-1][1] < 0xFFFF:
+            runs[-1][1] += 1
+        else:
+            runs.append([entry[0], 1])
+    return runs
+
+
+def encode_addr(addrs):
+    """Address deltas, same decoding as ps7_next_addr() in ps7_init.c"""
+    out = []
+    prev = ADDR_ORIGIN
+    for a in addrs:
+        d = a - prev
+        if -0x8000 < d < 0x8000:
+            out.append(d & 0xFFFF)
+        else:
+            out += [ADDR_FAR, a >> 16, a & 0xFFFF]
+        prev = a
+    return out
+
+
+def decode_addr(words, count):
+    out = []
+    prev = ADDR_ORIGIN
+    i = 0
+    for _ in range(count):
+        d = words[i]
+        if d == ADDR_FAR:
+            prev = (words[i + 1] << 16) | words[i + 2]
+            i += 3
+        else:
+            prev = (prev + d - (0x10000 if d & 0x8000 else 0)) & FULL_MASK
+            i += 1
+        out.append(prev)
+    if i != len(words):
+        raise ValueError("address array length mismatch")
+    return out
+
+
+def split_name(name):
+    """Return the table kind a sequence is expanded from, so all silicon
+    versions and variants of a table share one base stream"""
+    m = re.match(r"ps7_(\w+?)_\d+_\d+(_\w+)?$", name)
+    return m.group(1) if m else name
+
+
+def make_deltas(base, seq):
+    """Return ([(at, skip, count)], patch entries) turning base into seq"""
+    sm = difflib.SequenceMatcher(None, [tuple(e) for e in base],
+                                 [tuple(e) for e in seq], autojunk=False)
+    deltas = []
+    patch = []
+    for tag, i1, i2, j1, j2 in sm.get_opcodes():
+        if tag == "equal":
+            continue
+        deltas.append((i1, i2 - i1, j2 - j1))
+        patch += seq[j1:j2]
+    if len(deltas) > 0xFFFF or len(base) > 0xFFFF:
+        raise ValueError("sequence too long for ps7_delta_t")
+    return deltas, patch
+
+
+def expand(base, deltas, patch):
+    out = []
+    pos = 0
+    k = 0
+    for at, skip, count in deltas:
+        out += base[pos:at]
+        out += patch[k:k + count]
+        pos = at + skip
+        k += count
+    return out + base[pos:]
+
+
+def stream_size(seq):
+    """Bytes of the packed arrays of a stream, ps7_stream_t included"""
+    addr = [e[1] for e in seq if OP_FIELDS[e[0]][0]]
+    return (4 * len(make_runs(seq)) + 2 * len(encode_addr(addr)) +
+            sum(1 for e in seq if OP_FIELDS[e[0]][1]) +
+            4 * sum(1 for e in seq if OP_FIELDS[e[0]][2]) + 20)
+
+
+def flat_size(seq):
+    """Bytes the sequence took as separate 32 bit arrays"""
+    return (4 * len(make_runs(seq)) + 20 +
+            4 * sum(sum(OP_FIELDS[e[0]]) for e in seq))
+
+
+def c_array(ctype, name, values, fmt, static=True):
+    lines = ["%sconst %s %s[] = {" % ("static " if static else "", ctype,
+                                      name)]
+    for i in range(0, len(values), 4):
+        lines.append("    " + ", ".join(fmt(v) for v in values[i:i + 4]) + ",")
+    lines.append("};")
+    return lines
+
+
+def prepare(name, ops, parallel_pll):
+    if parallel_pll and "_pll_init_" in name:
+        reordered = parallel_plls(ops)
+        if reordered is None:
+            print("warning: %s: unexpected PLL sequence, kept in order" %
+                  name, file=sys.stderr)
+        else:
+            return reordered
+    return ops
+
+
+def is_ddriob(addr):
+    return DDRIOB_FIRST <= addr <= DDRIOB_LAST
+
+
+def warm_mio(ops):
+    """MIO table without the DDRIOB set up"""
+    return [(op, args) for op, args in ops
+            if op not in ("MASKWRITE", "WRITE", "CLEAR") or
+            not is_ddriob(args[0])]
+
+
+def fingerprint(mio_ops, pll_ops, ddr_ops):
+    """Return [(addr, mask, value)] of the bits written by the PLL and DDR
+    tables and by the DDRIOB part of the MIO table, in first write order"""
+    bits = {}
+    order = []
+    ops = [o for o in mio_ops if o[0] != "EXIT" and is_ddriob(o[1][0])]
+    ops += [o for o in pll_ops + ddr_ops if o[0] != "EXIT"]
+    for op, args in ops:
+        if op == "MASKWRITE":
+            addr, mask, val = args
+        elif op == "WRITE":
+            addr, mask, val = args[0], FULL_MASK, args[1]
+        elif op == "CLEAR":
+            addr, mask, val = args[0], FULL_MASK, 0
+        else:
+            continue
+        if addr in NO_FINGERPRINT:
+            continue
+        if addr not in bits:
+            bits[addr] = [0, 0]
+            order.append(addr)
+        bits[addr][0] |= mask
+        bits[addr][1] = (bits[addr][1] & ~mask) | (val & mask)
+    return [(a, bits[a][0], bits[a][1]) for a in order]
+
+
+def fingerprint_sum(values):
+    """Same fold as ps7_fingerprint() in ps7_init.c"""
+    total = 0
+    for v in values:
+        total = (((total << 1) | (total >> 31)) & FULL_MASK) ^ v
+    return total
+
+
+def versions(tables):
+    names = dict(tables)
+    out = []
+    for name in names:
+        m = re.match(r"ps7_pll_init_data_(\w+)$", name)
+        if m and "ps7_ddr_init_data_" + m.group(1) in names and \
+                "ps7_mio_init_data_" + m.group(1) in names:
+            out.append(m.group(1))
+    return out
+
+
+def split_ddr(ops):
+    """Split the DDR table before the write releasing the DDRC reset"""
+    last = None
+    for i, (op, args) in enumerate(ops):
+        if op == "MASKWRITE" and args[0] == DDRC_CTRL and \
+                (args[1] & args[2] & 1):
+            last = i
+    if last is None:
+        raise ValueError("DDRC reset release not found")
+    return ops[:last], ops[last:]
+
+
+def emit_stream(name, seq, masks):
+    runs = make_runs(seq)
+    addr = encode_addr([e[1] for e in seq if OP_FIELDS[e[0]][0]])
+    mask = [masks.index(e[2]) for e in seq if OP_FIELDS[e[0]][1]]
+    val = [e[3] for e in seq if OP_FIELDS[e[0]][2]]
+    lines = ["/* %s: %d entries in %d runs, %d bytes */" %
+             (name, len(seq), len(runs), stream_size(seq))]
+    lines += c_array("ps7_run_t", name + "_runs", runs,
+                     lambda r: "{ %s, %d }" % (OP_NAMES[r[0]], r[1]))
+    lines += c_array("unsigned short", name + "_addr", addr,
+                     lambda v: "0x%04X" % v)
+    for field, values, fmt in (("mask", mask, lambda v: "%d" % v),
+                               ("val", val, lambda v: "0x%08XU" % v)):
+        if values:
+            lines += c_array({"mask": "unsigned char",
+                              "val": "unsigned long"}[field],
+                             name + "_" + field, values, fmt)
+    lines.append("static const ps7_stream_t %s = {" % name)
+    lines.append("    %s_runs," % name)
+    lines.append("    %d," % len(runs))
+    lines.append("    %s_addr," % name)
+    lines.append("    %s," % (name + "_mask" if mask else "0"))
+    lines.append("    %s," % (name + "_val" if val else "0"))
+    lines.append("};")
+    lines.append("")
+    return lines
+
+
+def emit_seq(name, seq, bases, masks):
+    """Emit name as its base stream plus deltas, the first sequence of each
+    kind becomes the base of that kind"""
+    kind = split_name(name)
+    lines = []
+    if kind not in bases:
+        stream = "ps7_%s_stream" % kind
+        bases[kind] = (stream, seq)
+        lines += emit_stream(stream, seq, masks)
+        deltas, patch = [], []
+        size = stream_size(seq)
+    else:
+        stream, base = bases[kind]
+        deltas, patch = make_deltas(base, seq)
+        size = 6 * len(deltas) + (stream_size(patch) if patch else 0)
+        lines.append("/* %s: %s with %d deltas */" %
+                     (name, stream, len(deltas)))
+        if patch:
+            lines += emit_stream(name + "_patch", patch, masks)
+        if deltas:
+            lines += c_array("ps7_delta_t", name + "_delta", deltas,
+                             lambda d: "{ %d, %d, %d }" % d)
+    lines.append("const ps7_seq_t %s_seq = {" % name)
+    lines.append("    &%s," % stream)
+    lines.append("    %s," % (name + "_delta" if deltas else "0"))
+    lines.append("    %d," % len(deltas))
+    lines.append("    %s," % ("&" + name + "_patch" if patch else "0"))
+    lines.append("};")
+    lines.append("")
+    return lines, size + 16
+
+
+def emit(tables, source, parallel_pll=True):
+    names = dict(tables)
+    groups = [(None, [(name, compile_table(prepare(name, ops, parallel_pll)))
+                      for name, ops in tables])]
+    groups.append(("PS7_WARM_RESET_FAST",
+                   [("ps7_mio_init_data_%s_warm" % ver,
+                     compile_table(warm_mio(names["ps7_mio_init_data_" +
+                                                  ver])))
+                    for ver in versions(tables)]))
+    seqs = []
+    for ver in versions(tables):
+        cfg, start = split_ddr(names["ps7_ddr_init_data_" + ver])
+        seqs.append(("ps7_ddr_init_data_%s_cfg" % ver, compile_table(cfg)))
+        seqs.append(("ps7_ddr_init_data_%s_start" % ver,
+                     compile_table(start)))
+    groups.append(("PS7_DDR_TRAIN_CACHE", seqs))
+
+    masks = []
+    for flag, seqs in groups:
+        for name, seq in seqs:
+            for e in seq:
+                if OP_FIELDS[e[0]][1] and e[2] not in masks:
+                    masks.append(e[2])
+    if len(masks) > 0x100:
+        raise ValueError("%d masks, more than ps7_masks[] can index" %
+                         len(masks))
+
+    body = []
+    bases = {}
+    size = flat = 4 * len(masks)
+    for flag, seqs in groups:
+        if flag:
+            body.append("#ifdef " + flag)
+            body.append("")
+        for name, seq in seqs:
+            lines, n = emit_seq(name, seq, bases, masks)
+            body += lines
+            if flag is None:
+                size += n
+                flat += flat_size(seq)
+        if flag:
+            body.append("#endif /* %s */" % flag)
+            body.append("")
+
+    hexfmt = lambda v: "0x%08XU" % v
+    lines = [
+        "/" + "*" * 78,
+        "*",
+        "* (c) Copyright 2010-2014 Xilinx, Inc. All rights reserved.",
+        "*",
+        "* Generated by tools/ps7_compile.py from %s, do not edit." % source,
+        "* Refer to ps7_init_gen.h for the sequence format.",
+        "*",
+        "* Sequences: %d bytes, %d bytes as separate tables." % (size, flat),
+        "*",
+        "*" * 78 + "/",
+        "",
+        '#include "ps7_init_gen.h"',
+        "",
+        "#ifdef PS7_INIT_PRECOMPILED",
+        "",
+    ]
+    lines += c_array("unsigned long", "ps7_masks", masks, hexfmt, False)
+    lines.append("")
+    lines += body
+    lines.append("#if defined(PS7_WARM_RESET_FAST) || "
+                 "defined(PS7_DDR_TRAIN_CACHE)")
+    lines.append("")
+    for ver in versions(tables):
+        mio = names["ps7_mio_init_data_" + ver]
+        fp = fingerprint(mio, names["ps7_pll_init_data_" + ver],
+                         names["ps7_ddr_init_data_" + ver])
+        name = "ps7_warm_fp_" + ver
+        lines.append("/* %s: %d registers */" % (name, len(fp)))
+        lines += c_array("unsigned long", name + "_addr",
+                         [f[0] for f in fp], hexfmt)
+        lines += c_array("unsigned long", name + "_mask",
+                         [f[1] for f in fp], hexfmt)
+        lines.append("const ps7_fp_t %s = {" % name)
+        lines.append("    %s_addr," % name)
+        lines.append("    %s_mask," % name)
+        lines.append("    %d," % len(fp))
+        lines.append("    0x%08XU," % fingerprint_sum(f[2] for f in fp))
+        lines.append("};")
+        lines.append("")
+    lines.append("#endif")
+    lines.append("")
+    lines.append("#endif /* PS7_INIT_PRECOMPILED */")
+    lines.append("")
+    return "\n".join(lines)
+
+
+# --- check ------------------------------------------------------------------
+
+# Reset values the PLL model depends on, everything else gets a pattern
+RESET_VALUES = {
+    0xF8000100: 0x0001A008,
+    0xF8000104: 0x0001A008,
+    0xF8000108: 0x0001A008,
+}
+
+
+class Model(object):
+    """Register file with deterministic reset values, logs every access"""
+
+    def __init__(self, pll=None):
+        self.regs = {}
+        self.log = []
+        self.pll = pll
+
+    def read(self, addr):
+        if addr not in self.regs:
+            self.regs[addr] = RESET_VALUES.get(
+                addr, (addr * 2654435761) & FULL_MASK)
+        return self.regs[addr]
+
+    def write(self, addr, val):
+        old = self.read(addr)
+        self.regs[addr] = val & FULL_MASK
+        self.log.append(("W", addr, val & FULL_MASK))
+        if self.pll:
+            self.pll.write(addr, old, val & FULL_MASK)
+
+    def sync(self, kind, addr, mask):
+        self.read(addr)
+        self.log.append((kind, addr, mask, dict(self.regs)))
+        if self.pll and kind in ("P", "A"):
+            self.pll.poll(addr, mask, kind == "A")
+
+
+class PllModel(object):
+    """Tracks the PLL bring-up rules on top of the register model:
+    - the reset of a PLL is released only while it is bypassed
+    - a PLL counts as locked only after a poll on its lock bit, after its
+      last reset release
+    - a poll on several lock bits must wait for all of them
+    - the bypass is removed only from a locked PLL whose configuration
+      has not changed since its reset
+    """
+
+    def __init__(self, name):
+        self.name = name
+        self.errors = []
+        self.state = {}
+        for k, ctrl in enumerate(PLL_CTRL):
+            self.state[ctrl] = {"bit": 1 << k, "locked": False,
+                                "stale": False}
+
+    def write(self, addr, old, new):
+        if addr - 0x10 in self.state:
+            pll = self.state[addr - 0x10]
+            pll["stale"] = True
+            pll["locked"] = False
+            return
+        if addr not in self.state:
+            return
+        pll = self.state[addr]
+        if (old ^ new) & PLL_FDIV:
+            pll["stale"] = True
+            pll["locked"] = False
+        if (new & PLL_RESET) and not (old & PLL_RESET):
+            pll["locked"] = False
+        if (old & PLL_RESET) and not (new & PLL_RESET):
+            if not (new & PLL_BYPASS_FORCE):
+                self.error("reset of 0x%08X released out of bypass" % addr)
+            pll["stale"] = False
+            pll["locked"] = False
+        if (old & PLL_BYPASS_FORCE) and not (new & PLL_BYPASS_FORCE):
+            if not pll["locked"] or pll["stale"]:
+                self.error("bypass of 0x%08X removed before lock" % addr)
+
+    def poll(self, addr, mask, all_bits):
+        if addr != PLL_STATUS:
+            return
+        if not all_bits and (mask & (mask - 1)):
+            self.error("poll of lock bits 0x%X returns on the first" % mask)
+        for ctrl, pll in self.state.items():
+            if mask & pll["bit"]:
+                pll["locked"] = True
+
+    def error(self, text):
+        self.errors.append("%s: %s" % (self.name, text))
+
+
+def run_table(ops, model):
+    for op, args in ops:
+        if op == "EXIT":
+            break
+        elif op == "CLEAR":
+            model.write(args[0], 0)
+        elif op == "WRITE":
+            model.write(args[0], args[1])
+        elif op == "MASKWRITE":
+            addr, mask, val = args
+            model.write(addr, (val & mask) | (model.read(addr) & ~mask))
+        elif op == "MASKPOLL":
+            model.sync("P", args[0], args[1])
+        elif op == "MASKPOLL_ALL":
+            model.sync("A", args[0], args[1])
+        elif op == "MASKDELAY":
+            model.sync("D", args[0], args[1])
+    model.sync("X", 0, 0)
+
+
+def run_seq(seq, model):
+    for op, addr, mask, val in seq:
+        if op == OP_WRITE:
+            model.write(addr, val)
+        elif op == OP_MASKWRITE:
+            model.write(addr, val | (model.read(addr) & ~mask))
+        elif op == OP_MASKPOLL:
+            model.sync("P", addr, mask)
+        elif op == OP_MASKPOLL_ALL:
+            model.sync("A", addr, mask)
+        elif op == OP_MASKDELAY:
+            model.sync("D", addr, mask)
+    model.sync("X", 0, 0)
+
+
+def parse_generated(path):
+    """Rebuild the expanded sequences from the emitted C"""
+    with open(path) as f:
+        text = f.read()
+    arrays = {}
+    for m in re.finditer(r"const [\w ]+ (\w+)\[\] = \{(.*?)\};",
+                         text, re.S):
+        arrays[m.group(1)] = m.group(2)
+    ints = lambda body: [parse_int(v) for v in body.split(",") if v.strip()]
+    masks = ints(arrays["ps7_masks"])
+    names = {v: k for k, v in OP_NAMES.items()}
+    streams = {}
+    for m in re.finditer(r"static const ps7_stream_t (\w+) = \{(.*?)\};",
+                         text, re.S):
+        name = m.group(1)
+        runs = [(names[o], int(c)) for o, c in
+                re.findall(r"\{ (\w+), (\d+) \}", arrays[name + "_runs"])]
+        data = {}
+        for field in ("mask", "val"):
+            data[field] = ints(arrays.get(name + "_" + field, ""))
+        data["mask"] = [masks[i] for i in data["mask"]]
+        data["addr"] = decode_addr(ints(arrays[name + "_addr"]),
+                                   sum(c for o, c in runs))
+        cursor = {"addr": 0, "mask": 0, "val": 0}
+        seq = []
+        for op, count in runs:
+            for _ in range(count):
+                entry = [op, 0, FULL_MASK, 0]
+                for i, field in enumerate(("addr", "mask", "val")):
+                    if OP_FIELDS[op][i]:
+                        entry[i + 1] = data[field][cursor[field]]
+                        cursor[field] += 1
+                seq.append(entry)
+        for field in cursor:
+            if cursor[field] != len(data[field]):
+                raise ValueError("%s: %s array length mismatch" %
+                                 (name, field))
+        streams[name] = seq
+    seqs = {}
+    for m in re.finditer(r"const ps7_seq_t (\w+)_seq = \{(.*?)\};",
+                         text, re.S):
+        fields = [f.strip() for f in m.group(2).split(",") if f.strip()]
+        base = streams[fields[0].lstrip("&")]
+        deltas = []
+        if fields[1] != "0":
+            deltas = [tuple(int(x) for x in d) for d in re.findall(
+                r"\{ (\d+), (\d+), (\d+) \}", arrays[fields[1]])]
+        if len(deltas) != int(fields[2]):
+            raise ValueError("%s: delta count mismatch" % m.group(1))
+        patch = streams[fields[3].lstrip("&")] if fields[3] != "0" else []
+        if sum(d[2] for d in deltas) != len(patch):
+            raise ValueError("%s: patch length mismatch" % m.group(1))
+        seqs[m.group(1)] = expand(base, deltas, patch)
+    return seqs
+
+
+def compare(name, orig, gen):
+    """Walk both access logs, return a list of error strings"""
+    errors = []
+    i = 0
+    regs = {}
+    for ev in gen:
+        if i >= len(orig):
+            return ["%s: extra access %r" % (name, ev[:3])]
+        if ev[0] == "W":
+            addr, val = ev[1], ev[2]
+            if orig[i][0] != "W" or orig[i][1] != addr:
+                return ["%s: write to 0x%08X out of order" % (name, addr)]
+            merged = 0
+            regs[addr] = orig[i][2]
+            i += 1
+            while (i < len(orig) and orig[i][0] == "W" and
+                   orig[i][1] == addr and
+                   (regs[addr] != val or orig[i][2] == val)):
+                regs[addr] = orig[i][2]
+                merged += 1
+                i += 1
+            if regs[addr] != val:
+                return ["%s: write 0x%08X = 0x%08X, expected 0x%08X" %
+                        (name, addr, val, regs[addr])]
+            if merged and addr in NO_MERGE:
+                errors.append("%s: writes to 0x%08X must not be merged" %
+                              (name, addr))
+        else:
+            if orig[i][:3] != ev[:3]:
+                return ["%s: %r where %r was expected" %
+                        (name, ev[:3], orig[i][:3])]
+            if orig[i][3] != ev[3]:
+                errors.append("%s: register state differs at %r" %
+                              (name, ev[:3]))
+            i += 1
+    if i != len(orig):
+        errors.append("%s: %d accesses missing" % (name, len(orig) - i))
+    return errors
+
+
+def compare_reordered(name, orig, gen):
+    """Same writes per register, in the same order per register, and the
+    same final state. The order between registers is left to PllModel."""
+    errors = []
+    per_reg = {}
+    for log, side in ((orig, 0), (gen, 1)):
+        for ev in log:
+            if ev[0] == "W":
+                per_reg.setdefault(ev[1], ([], []))[side].append(ev[2])
+    for addr in sorted(per_reg):
+        if per_reg[addr][0] != per_reg[addr][1]:
+            errors.append("%s: writes to 0x%08X differ" % (name, addr))
+    if orig[-1][3] != gen[-1][3]:
+        errors.append("%s: final register state differs" % name)
+    return errors
+
+
+def parse_fingerprints(path):
+    with open(path) as f:
+        text = f.read()
+    arrays = {}
+    for m in re.finditer(r"static const [\w ]+ (\w+)\[\] = \{(.*?)\};",
+                         text, re.S):
+        arrays[m.group(1)] = [parse_int(v) for v in m.group(2).split(",")
+                              if v.strip() and "{" not in m.group(2)]
+    fps = {}
+    for m in re.finditer(r"const ps7_fp_t (\w+) = \{(.*?)\};", text, re.S):
+        fields = [f.strip() for f in m.group(2).split(",") if f.strip()]
+        fps[m.group(1)] = (arrays[fields[0]], arrays[fields[1]],
+                           int(fields[2]), parse_int(fields[3]))
+    return fps
+
+
+def check_warm(tables, seqs, fps):
+    """The warm MIO sequence must be the MIO table minus the DDRIOB
+    writes, and the fingerprint must match the state a cold init leaves"""
+    errors = []
+    names = dict(tables)
+    for ver in versions(tables):
+        name = "ps7_mio_init_data_%s_warm" % ver
+        if name not in seqs:
+            errors.append("%s: missing" % name)
+            continue
+        orig = Model()
+        run_table(warm_mio(names["ps7_mio_init_data_" + ver]), orig)
+        gen = Model()
+        run_seq(seqs[name], gen)
+        errors += compare(name, orig.log, gen.log)
+        if any(e[0] != "W" or is_ddriob(e[1]) for e in gen.log if e[0] == "W"):
+            errors.append("%s: writes DDRIOB" % name)
+
+        fpname = "ps7_warm_fp_" + ver
+        if fpname not in fps:
+            errors.append("%s: missing" % fpname)
+            continue
+        addr, mask, count, total = fps[fpname]
+        model = Model()
+        for table in ("mio", "pll", "ddr"):
+            run_table(names["ps7_%s_init_data_%s" % (table, ver)], model)
+        if count != len(addr) or count != len(mask):
+            errors.append("%s: count mismatch" % fpname)
+        elif fingerprint_sum(model.regs[a] & m
+                             for a, m in zip(addr, mask)) != total:
+            errors.append("%s: does not match a cold init" % fpname)
+        print("%-32s %4d registers" % (fpname, count))
+    return errors
+
+
+def check_ddr_split(tables, seqs):
+    """_cfg followed by _start must be the DDR table, and _start must leave
+    the registers set from a training record alone"""
+    errors = []
+    names = dict(tables)
+    for ver in versions(tables):
+        name = "ps7_ddr_init_data_" + ver
+        if name + "_cfg" not in seqs or name + "_start" not in seqs:
+            errors.append("%s: _cfg/_start missing" % name)
+            continue
+        orig = Model()
+        run_table(names[name], orig)
+        gen = Model()
+        seq = seqs[name + "_cfg"] + seqs[name + "_start"]
+        run_seq(seq, gen)
+        errors += compare(name + "_cfg/_start", orig.log, gen.log)
+        for e in seqs[name + "_start"]:
+            if e[0] in (OP_WRITE, OP_MASKWRITE) and e[1] in DDR_TRAIN_REGS:
+                errors.append("%s_start: writes 0x%08X" % (name, e[1]))
+    return errors
+
+
+def check(source, generated):
+    seqs = parse_generated(generated)
+    errors = []
+    tables = parse_tables(source)
+    for name, ops in tables:
+        if name not in seqs:
+            errors.append("%s: not in %s" % (name, generated))
+            continue
+        pll = PllModel(name + " (tables)")
+        orig = Model(pll)
+        run_table(ops, orig)
+        errors += pll.errors
+        pll = PllModel(name)
+        gen = Model(pll)
+        run_seq(seqs[name], gen)
+        errors += pll.errors
+        if any(e[0] == OP_MASKPOLL_ALL for e in seqs[name]):
+            errors += compare_reordered(name, orig.log, gen.log)
+        else:
+            errors += compare(name, orig.log, gen.log)
+        writes = sum(1 for e in orig.log if e[0] == "W")
+        gwrites = sum(1 for e in gen.log if e[0] == "W")
+        print("%-32s %4d writes -> %4d" % (name, writes, gwrites))
+    errors += check_warm(tables, seqs, parse_fingerprints(generated))
+    errors += check_ddr_split(tables, seqs)
+    for e in errors:
+        print("error: " + e, file=sys.stderr)
+    return 1 if errors else 0
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    src = os.path.join(here, "..", "src")
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--check", action="store_true",
+                        help="verify the generated file against the tables")
+    parser.add_argument("--no-parallel-pll", action="store_true",
+                        help="keep the PCW order of the PLL bring-up")
+    parser.add_argument("-o", "--output",
+                        default=os.path.join(src, "ps7_init_gen.c"))
+    parser.add_argument("source", nargs="?",
+                        default=os.path.join(src, "ps7_init.c"))
+    parser.add_argument("generated", nargs="?")
+    args = parser.parse_args()
+
+    if args.check:
+        return check(args.source, args.generated or args.output)
+
+    text = emit(parse_tables(args.source), os.path.basename(args.source),
+                not args.no_parallel_pll)
+    with open(args.output, "w") as f:
+        f.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())